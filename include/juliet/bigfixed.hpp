@@ -0,0 +1,294 @@
+#pragma once
+
+#include <juliet/common.hpp>
+#include <juliet/floatexp.hpp>
+
+namespace juliet {
+
+    /*
+        A signed fixed-point number with a 64-bit integer
+        part and a runtime-chosen number of 64-bit limbs
+        for its fractional part.
+
+        The numbers we deal with never stray far from
+        the origin, so we don't need a floating exponent,
+        just plenty of bits after the point.
+    */
+    struct bigfixed {
+        /* NOTE: Little-endian, with the last limb holding the integer part in two's complement. */
+        std::vector<std::uint64_t> _limbs;
+
+        constexpr bigfixed() : bigfixed(0uz) {}
+
+        constexpr explicit bigfixed(const std::size_t num_fraction_limbs) : _limbs(num_fraction_limbs + 1, 0) {}
+
+        /* The number of fractional limbs needed to resolve a number to well under the pixel scale. */
+        static constexpr std::size_t fraction_limbs_for_scale(const juliet::floatexp pixel_scale) {
+            /* NOTE: We keep an extra limb's worth of guard bits. */
+            const auto num_bits = static_cast<std::size_t>(std::max(std::int64_t{0}, -pixel_scale.exponent)) + 64;
+
+            return (num_bits + 63) / 64;
+        }
+
+        static constexpr bigfixed from_floatexp(const juliet::floatexp value, const std::size_t num_fraction_limbs) {
+            auto result = bigfixed(num_fraction_limbs);
+
+            if (value.is_zero()) {
+                return result;
+            }
+
+            /* NOTE: Now 'value == bits * 2^(value.exponent - MantissaBits)'. */
+            auto bits = static_cast<std::uint64_t>(std::abs(value.mantissa) * juliet::floatexp::_power_of_two(juliet::floatexp::MantissaBits));
+
+            /* NOTE: The bit position of the lowest set bit, relative to the lowest bit of our limbs. */
+            auto position = value.exponent - juliet::floatexp::MantissaBits + 64 * static_cast<std::int64_t>(num_fraction_limbs);
+
+            if (position < 0) {
+                if (position <= -64) {
+                    return result;
+                }
+
+                bits     >>= -position;
+                position   = 0;
+            }
+
+            /* NOTE: Too large to fit in our integer part, which we don't expect to happen. */
+            if (position >= 64 * static_cast<std::int64_t>(result._limbs.size())) {
+                return result;
+            }
+
+            const auto limb  = static_cast<std::size_t>(position / 64);
+            const auto shift = static_cast<int>(position % 64);
+
+            result._limbs[limb] |= bits << shift;
+
+            if (shift != 0 && limb + 1 < result._limbs.size()) {
+                result._limbs[limb + 1] |= bits >> (64 - shift);
+            }
+
+            if (value.mantissa < 0) {
+                return -result;
+            }
+
+            return result;
+        }
+
+        static constexpr bigfixed from_scalar(const juliet::scalar value, const std::size_t num_fraction_limbs) {
+            return bigfixed::from_floatexp(value, num_fraction_limbs);
+        }
+
+        constexpr std::size_t num_fraction_limbs(this const bigfixed &self) {
+            return self._limbs.size() - 1;
+        }
+
+        constexpr bool is_negative(this const bigfixed &self) {
+            return (self._limbs.back() >> 63) != 0;
+        }
+
+        constexpr bigfixed with_fraction_limbs(this bigfixed self, const std::size_t num_fraction_limbs) {
+            const auto current_limbs = self.num_fraction_limbs();
+
+            /* NOTE: Our fractional limbs come first, so that's where we add or drop them. */
+            if (num_fraction_limbs > current_limbs) {
+                self._limbs.insert(self._limbs.begin(), num_fraction_limbs - current_limbs, 0);
+            } else {
+                self._limbs.erase(self._limbs.begin(), self._limbs.begin() + static_cast<std::ptrdiff_t>(current_limbs - num_fraction_limbs));
+            }
+
+            return self;
+        }
+
+        constexpr juliet::scalar to_scalar(this const bigfixed &self) {
+            const auto negative  = self.is_negative();
+            const auto magnitude = negative ? -self : self;
+
+            const auto num_fraction_limbs = static_cast<int>(self.num_fraction_limbs());
+
+            /* NOTE: Three limbs from the first nonzero one is more than enough to fill a double. */
+            auto result = 0.0_scalar;
+            auto num_summed = 0uz;
+            for (const auto i : std::views::iota(0uz, magnitude._limbs.size()) | std::views::reverse) {
+                const auto limb = magnitude._limbs[i];
+                if (limb == 0 && num_summed == 0) {
+                    continue;
+                }
+
+                result += std::ldexp(static_cast<juliet::scalar>(limb), 64 * (static_cast<int>(i) - num_fraction_limbs));
+
+                ++num_summed;
+                if (num_summed == 3) {
+                    break;
+                }
+            }
+
+            return negative ? -result : result;
+        }
+
+        static constexpr void _match_precision(bigfixed &lhs, bigfixed &rhs) {
+            const auto num_fraction_limbs = std::max(lhs.num_fraction_limbs(), rhs.num_fraction_limbs());
+
+            if (lhs.num_fraction_limbs() != num_fraction_limbs) {
+                lhs = std::move(lhs).with_fraction_limbs(num_fraction_limbs);
+            }
+
+            if (rhs.num_fraction_limbs() != num_fraction_limbs) {
+                rhs = std::move(rhs).with_fraction_limbs(num_fraction_limbs);
+            }
+        }
+
+        constexpr bigfixed operator -(this bigfixed self) {
+            /* NOTE: Two's complement negation is inverting and then adding one. */
+            auto carry = std::uint64_t{1};
+            for (auto &limb : self._limbs) {
+                const auto sum = impl::uint128{~limb} + carry;
+
+                limb  = static_cast<std::uint64_t>(sum);
+                carry = static_cast<std::uint64_t>(sum >> 64);
+            }
+
+            return self;
+        }
+
+        friend constexpr bigfixed operator +(bigfixed lhs, bigfixed rhs) {
+            bigfixed::_match_precision(lhs, rhs);
+
+            auto carry = std::uint64_t{0};
+            for (const auto i : std::views::iota(0uz, lhs._limbs.size())) {
+                const auto sum = impl::uint128{lhs._limbs[i]} + rhs._limbs[i] + carry;
+
+                lhs._limbs[i] = static_cast<std::uint64_t>(sum);
+                carry         = static_cast<std::uint64_t>(sum >> 64);
+            }
+
+            return lhs;
+        }
+
+        friend constexpr bigfixed operator -(bigfixed lhs, bigfixed rhs) {
+            return std::move(lhs) + -std::move(rhs);
+        }
+
+        friend constexpr bigfixed operator *(bigfixed lhs, bigfixed rhs) {
+            bigfixed::_match_precision(lhs, rhs);
+
+            const auto negative = (lhs.is_negative() != rhs.is_negative());
+
+            if (lhs.is_negative()) {
+                lhs = -std::move(lhs);
+            }
+
+            if (rhs.is_negative()) {
+                rhs = -std::move(rhs);
+            }
+
+            const auto num_limbs          = lhs._limbs.size();
+            const auto num_fraction_limbs = lhs.num_fraction_limbs();
+
+            auto product = std::vector<std::uint64_t>(2 * num_limbs, 0);
+            for (const auto i : std::views::iota(0uz, num_limbs)) {
+                auto carry = std::uint64_t{0};
+
+                for (const auto j : std::views::iota(0uz, num_limbs)) {
+                    const auto term = impl::uint128{lhs._limbs[i]} * rhs._limbs[j] + product[i + j] + carry;
+
+                    product[i + j] = static_cast<std::uint64_t>(term);
+                    carry          = static_cast<std::uint64_t>(term >> 64);
+                }
+
+                product[i + num_limbs] = carry;
+            }
+
+            /* NOTE: We truncate away the extra fractional limbs, and assume the integer part doesn't overflow. */
+            auto result = bigfixed(num_fraction_limbs);
+            std::ranges::copy_n(product.begin() + static_cast<std::ptrdiff_t>(num_fraction_limbs), static_cast<std::ptrdiff_t>(num_limbs), result._limbs.begin());
+
+            if (negative) {
+                return -std::move(result);
+            }
+
+            return result;
+        }
+    };
+
+    struct bigfixed_complex {
+        juliet::bigfixed real;
+        juliet::bigfixed imag;
+
+        static constexpr bigfixed_complex from_complex(const juliet::complex num, const std::size_t num_fraction_limbs) {
+            return bigfixed_complex::from_scaled_complex(num, 0, num_fraction_limbs);
+        }
+
+        /* Returns 'num * 2^exponent', for numbers too small to be held by scalars. */
+        static constexpr bigfixed_complex from_scaled_complex(const juliet::complex num, const std::int64_t exponent, const std::size_t num_fraction_limbs) {
+            return {
+                juliet::bigfixed::from_floatexp(juliet::floatexp::from_parts(num.real(), exponent), num_fraction_limbs),
+                juliet::bigfixed::from_floatexp(juliet::floatexp::from_parts(num.imag(), exponent), num_fraction_limbs)
+            };
+        }
+
+        constexpr std::size_t num_fraction_limbs(this const bigfixed_complex &self) {
+            return std::max(self.real.num_fraction_limbs(), self.imag.num_fraction_limbs());
+        }
+
+        constexpr bigfixed_complex with_fraction_limbs(this const bigfixed_complex &self, const std::size_t num_fraction_limbs) {
+            return {
+                self.real.with_fraction_limbs(num_fraction_limbs),
+                self.imag.with_fraction_limbs(num_fraction_limbs)
+            };
+        }
+
+        constexpr juliet::complex to_complex(this const bigfixed_complex &self) {
+            return {self.real.to_scalar(), self.imag.to_scalar()};
+        }
+
+        friend constexpr bigfixed_complex operator +(const bigfixed_complex &lhs, const bigfixed_complex &rhs) {
+            return {lhs.real + rhs.real, lhs.imag + rhs.imag};
+        }
+    };
+
+    namespace test {
+
+        /* NOTE: Negative one is all ones in the integer part, and zero after the point. */
+        static_assert([]() {
+            const auto negative_one = juliet::bigfixed::from_scalar(-1.0_scalar, 1);
+
+            return negative_one._limbs[0] == 0 && negative_one._limbs[1] == ~std::uint64_t{0};
+        }());
+
+        static_assert((juliet::bigfixed::from_scalar(-1.5_scalar, 1) + juliet::bigfixed::from_scalar(0.25_scalar, 1)).to_scalar() == -1.25_scalar);
+        static_assert((juliet::bigfixed::from_scalar(0.25_scalar, 1) - juliet::bigfixed::from_scalar(1.5_scalar, 1)).to_scalar() == -1.25_scalar);
+
+        static_assert((-juliet::bigfixed::from_scalar( 0.75_scalar, 2)).to_scalar() == -0.75_scalar);
+        static_assert((-juliet::bigfixed::from_scalar(-0.75_scalar, 2)).to_scalar() ==  0.75_scalar);
+
+        static_assert([]() {
+            const auto num = juliet::bigfixed::from_scalar(-0.1_scalar, 2);
+
+            return std::ranges::all_of((num + -num)._limbs, [](const std::uint64_t limb) {
+                return limb == 0;
+            });
+        }());
+
+        static_assert((juliet::bigfixed::from_scalar(-1.5_scalar, 1) * juliet::bigfixed::from_scalar( 0.5_scalar,  1)).to_scalar() == -0.75_scalar);
+        static_assert((juliet::bigfixed::from_scalar(-1.5_scalar, 1) * juliet::bigfixed::from_scalar(-2.25_scalar, 1)).to_scalar() ==  3.375_scalar);
+
+        /* NOTE: The product lies entirely past the first fractional limb. */
+        static_assert(
+            (
+                juliet::bigfixed::from_floatexp(juliet::floatexp::from_parts(-1.0_scalar, -70), 2) *
+                juliet::bigfixed::from_floatexp(juliet::floatexp::from_parts( 1.0_scalar, -30), 2)
+            ).to_scalar() == -std::ldexp(1.0_scalar, -100)
+        );
+
+        static_assert(juliet::bigfixed::from_scalar( 3.0_scalar,     0).to_scalar() ==  3.0_scalar);
+        static_assert(juliet::bigfixed::from_scalar( 0.1_scalar,     1).to_scalar() ==  0.1_scalar);
+        static_assert(juliet::bigfixed::from_scalar(-0.1_scalar,     1).to_scalar() == -0.1_scalar);
+        static_assert(juliet::bigfixed::from_scalar(-1.0e-30_scalar, 3).to_scalar() == -1.0e-30_scalar);
+
+        static_assert(juliet::bigfixed::from_floatexp(juliet::floatexp::from_parts(-1.25_scalar, -200), 4).to_scalar() == -std::ldexp(1.25_scalar, -200));
+
+        /* NOTE: Bits past our last limb are truncated away. */
+        static_assert(juliet::bigfixed::from_floatexp(juliet::floatexp::from_parts(1.0_scalar, -200), 2).to_scalar() == 0.0_scalar);
+
+    }
+
+}
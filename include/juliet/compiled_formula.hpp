@@ -0,0 +1,458 @@
+#pragma once
+
+#include <juliet/common.hpp>
+#include <juliet/simd.hpp>
+#include <juliet/sets.hpp>
+#include <juliet/formula.hpp>
+
+namespace juliet {
+
+    namespace impl {
+
+        /* What the terms of a compiled formula are evaluated with, at each step of an orbit. */
+        template<typename Value>
+        struct term_context {
+            const Value &real;
+            const Value &imag;
+
+            /* NOTE: Our kernels have already squared the parts of the orbit for checking escapes, so terms can reuse them. */
+            const Value &real_sq;
+            const Value &imag_sq;
+
+            const Value &constant_real;
+            const Value &constant_imag;
+        };
+
+        template<typename Term, typename Value>
+        [[gnu::always_inline]]
+        constexpr std::pair<Value, Value> square_term(const impl::term_context<Value> &context) {
+            if constexpr (requires { Term::square(context); }) {
+                return Term::square(context);
+            } else {
+                const auto [real, imag] = Term::evaluate(context);
+
+                return {real * real - imag * imag, (real + real) * imag};
+            }
+        }
+
+        /* The squares of the real and imaginary parts of the term, without squaring the term itself. */
+        template<typename Term, typename Value>
+        [[gnu::always_inline]]
+        constexpr std::pair<Value, Value> squared_parts(const impl::term_context<Value> &context) {
+            if constexpr (requires { Term::squared_parts(context); }) {
+                return Term::squared_parts(context);
+            } else {
+                const auto [real, imag] = Term::evaluate(context);
+
+                return {real * real, imag * imag};
+            }
+        }
+
+    }
+
+    /*
+        The pieces of formulas which are compiled along with
+        everything else, e.g. 'z*z*z + c', for sets which are
+        as fast as those written out by hand.
+
+        Each term is an empty type which evaluates itself, so
+        a whole formula inlines into a single step of an orbit,
+        for plain scalars and for vectors alike.
+
+        NOTE: Squares are spotted from the types of terms, and
+        squares of the orbit itself reuse the squares of its
+        parts which were computed for checking escapes, the
+        same as our hand-written steps. Any other repeated
+        terms are repeated arithmetic on the same values,
+        which the compiler merges on its own.
+    */
+    namespace terms {
+
+        /* The value of the orbit, 'z'. */
+        struct value {
+            template<typename Value>
+            [[gnu::always_inline]]
+            static constexpr std::pair<Value, Value> evaluate(const impl::term_context<Value> &context) {
+                return {context.real, context.imag};
+            }
+
+            template<typename Value>
+            [[gnu::always_inline]]
+            static constexpr std::pair<Value, Value> squared_parts(const impl::term_context<Value> &context) {
+                return {context.real_sq, context.imag_sq};
+            }
+
+            /* NOTE: Exactly the same operations as 'impl::quadratic_step'. */
+            template<typename Value>
+            [[gnu::always_inline]]
+            static constexpr std::pair<Value, Value> square(const impl::term_context<Value> &context) {
+                return {context.real_sq - context.imag_sq, (context.real + context.real) * context.imag};
+            }
+        };
+
+        /* The constant of the orbit, 'c'. */
+        struct constant {
+            template<typename Value>
+            [[gnu::always_inline]]
+            static constexpr std::pair<Value, Value> evaluate(const impl::term_context<Value> &context) {
+                return {context.constant_real, context.constant_imag};
+            }
+        };
+
+        template<juliet::scalar Real, juliet::scalar Imag>
+        struct number {
+            template<typename Value>
+            [[gnu::always_inline]]
+            static constexpr std::pair<Value, Value> evaluate(const impl::term_context<Value> &) {
+                return {simd::broadcast<Value>(Real), simd::broadcast<Value>(Imag)};
+            }
+        };
+
+        template<typename Term>
+        struct is_real_number : std::false_type {};
+
+        template<juliet::scalar Real>
+        struct is_real_number<terms::number<Real, 0.0_scalar>> : std::true_type {};
+
+        template<typename Lhs, typename Rhs>
+        struct sum {
+            template<typename Value>
+            [[gnu::always_inline]]
+            static constexpr std::pair<Value, Value> evaluate(const impl::term_context<Value> &context) {
+                const auto [lhs_real, lhs_imag] = Lhs::evaluate(context);
+                const auto [rhs_real, rhs_imag] = Rhs::evaluate(context);
+
+                /* NOTE: Adding a real number leaves the imaginary part alone, which the compiler can't assume for itself. */
+                if constexpr (terms::is_real_number<Rhs>::value) {
+                    return {lhs_real + rhs_real, lhs_imag};
+                } else {
+                    return {lhs_real + rhs_real, lhs_imag + rhs_imag};
+                }
+            }
+        };
+
+        template<typename Lhs, typename Rhs>
+        struct difference {
+            template<typename Value>
+            [[gnu::always_inline]]
+            static constexpr std::pair<Value, Value> evaluate(const impl::term_context<Value> &context) {
+                const auto [lhs_real, lhs_imag] = Lhs::evaluate(context);
+                const auto [rhs_real, rhs_imag] = Rhs::evaluate(context);
+
+                if constexpr (terms::is_real_number<Rhs>::value) {
+                    return {lhs_real - rhs_real, lhs_imag};
+                } else {
+                    return {lhs_real - rhs_real, lhs_imag - rhs_imag};
+                }
+            }
+        };
+
+        template<typename Lhs, typename Rhs>
+        struct product {
+            template<typename Value>
+            [[gnu::always_inline]]
+            static constexpr std::pair<Value, Value> evaluate(const impl::term_context<Value> &context) {
+                if constexpr (std::same_as<Lhs, Rhs>) {
+                    return impl::square_term<Lhs>(context);
+                } else {
+                    const auto [lhs_real, lhs_imag] = Lhs::evaluate(context);
+                    const auto [rhs_real, rhs_imag] = Rhs::evaluate(context);
+
+                    if constexpr (terms::is_real_number<Lhs>::value) {
+                        return {lhs_real * rhs_real, lhs_real * rhs_imag};
+                    } else if constexpr (terms::is_real_number<Rhs>::value) {
+                        return {lhs_real * rhs_real, lhs_imag * rhs_real};
+                    } else {
+                        return {lhs_real * rhs_real - lhs_imag * rhs_imag, lhs_real * rhs_imag + lhs_imag * rhs_real};
+                    }
+                }
+            }
+        };
+
+        template<typename Lhs, typename Rhs>
+        struct quotient {
+            template<typename Value>
+            [[gnu::always_inline]]
+            static constexpr std::pair<Value, Value> evaluate(const impl::term_context<Value> &context) {
+                const auto [lhs_real, lhs_imag] = Lhs::evaluate(context);
+                const auto [rhs_real, rhs_imag] = Rhs::evaluate(context);
+
+                const auto [rhs_real_sq, rhs_imag_sq] = impl::squared_parts<Rhs>(context);
+                const auto denominator = rhs_real_sq + rhs_imag_sq;
+
+                return {
+                    (lhs_real * rhs_real + lhs_imag * rhs_imag) / denominator,
+                    (lhs_imag * rhs_real - lhs_real * rhs_imag) / denominator
+                };
+            }
+        };
+
+        template<typename Operand>
+        struct negation {
+            template<typename Value>
+            [[gnu::always_inline]]
+            static constexpr std::pair<Value, Value> evaluate(const impl::term_context<Value> &context) {
+                const auto [real, imag] = Operand::evaluate(context);
+
+                return {-real, -imag};
+            }
+
+            template<typename Value>
+            [[gnu::always_inline]]
+            static constexpr std::pair<Value, Value> squared_parts(const impl::term_context<Value> &context) {
+                return impl::squared_parts<Operand>(context);
+            }
+
+            template<typename Value>
+            [[gnu::always_inline]]
+            static constexpr std::pair<Value, Value> square(const impl::term_context<Value> &context) {
+                return impl::square_term<Operand>(context);
+            }
+        };
+
+        template<typename Operand>
+        struct conjugate {
+            template<typename Value>
+            [[gnu::always_inline]]
+            static constexpr std::pair<Value, Value> evaluate(const impl::term_context<Value> &context) {
+                const auto [real, imag] = Operand::evaluate(context);
+
+                return {real, -imag};
+            }
+
+            template<typename Value>
+            [[gnu::always_inline]]
+            static constexpr std::pair<Value, Value> squared_parts(const impl::term_context<Value> &context) {
+                return impl::squared_parts<Operand>(context);
+            }
+
+            /* NOTE: The square of the conjugate is the conjugate of the square. */
+            template<typename Value>
+            [[gnu::always_inline]]
+            static constexpr std::pair<Value, Value> square(const impl::term_context<Value> &context) {
+                const auto [real, imag] = impl::square_term<Operand>(context);
+
+                return {real, -imag};
+            }
+        };
+
+        /* NOTE: Takes the absolute value of each part separately, as for the Burning Ship. */
+        template<typename Operand>
+        struct abs_components {
+            template<typename Value>
+            [[gnu::always_inline]]
+            static constexpr std::pair<Value, Value> evaluate(const impl::term_context<Value> &context) {
+                const auto [real, imag] = Operand::evaluate(context);
+
+                return {simd::abs(real), simd::abs(imag)};
+            }
+
+            template<typename Value>
+            [[gnu::always_inline]]
+            static constexpr std::pair<Value, Value> squared_parts(const impl::term_context<Value> &context) {
+                return impl::squared_parts<Operand>(context);
+            }
+
+            /* NOTE: As in 'impl::burning_ship_step', '2|a||b|' is the same as '|2ab|', which saves us an absolute value. */
+            template<typename Value>
+            [[gnu::always_inline]]
+            static constexpr std::pair<Value, Value> square(const impl::term_context<Value> &context) {
+                const auto [real, imag] = impl::square_term<Operand>(context);
+
+                return {real, simd::abs(imag)};
+            }
+        };
+
+        template<typename Base, std::size_t Exponent>
+        requires (Exponent >= 1)
+        struct power {
+            template<typename Value>
+            [[gnu::always_inline]]
+            static constexpr std::pair<Value, Value> evaluate(const impl::term_context<Value> &context) {
+                if constexpr (Exponent == 1) {
+                    return Base::evaluate(context);
+                } else if constexpr (Exponent == 2) {
+                    return impl::square_term<Base>(context);
+                } else {
+                    const auto [real,    imag]    = Base::evaluate(context);
+                    const auto [real_sq, imag_sq] = impl::squared_parts<Base>(context);
+
+                    return impl::raise_to_power<Exponent>(real, imag, real_sq, imag_sq);
+                }
+            }
+        };
+
+        template<typename T>
+        struct is_term : std::false_type {};
+
+        template<>
+        struct is_term<terms::value> : std::true_type {};
+
+        template<>
+        struct is_term<terms::constant> : std::true_type {};
+
+        template<juliet::scalar Real, juliet::scalar Imag>
+        struct is_term<terms::number<Real, Imag>> : std::true_type {};
+
+        template<typename Lhs, typename Rhs>
+        struct is_term<terms::sum<Lhs, Rhs>> : std::true_type {};
+
+        template<typename Lhs, typename Rhs>
+        struct is_term<terms::difference<Lhs, Rhs>> : std::true_type {};
+
+        template<typename Lhs, typename Rhs>
+        struct is_term<terms::product<Lhs, Rhs>> : std::true_type {};
+
+        template<typename Lhs, typename Rhs>
+        struct is_term<terms::quotient<Lhs, Rhs>> : std::true_type {};
+
+        template<typename Operand>
+        struct is_term<terms::negation<Operand>> : std::true_type {};
+
+        template<typename Operand>
+        struct is_term<terms::conjugate<Operand>> : std::true_type {};
+
+        template<typename Operand>
+        struct is_term<terms::abs_components<Operand>> : std::true_type {};
+
+        template<typename Base, std::size_t Exponent>
+        struct is_term<terms::power<Base, Exponent>> : std::true_type {};
+
+        template<typename T>
+        concept term = terms::is_term<std::remove_cvref_t<T>>::value;
+
+        constexpr inline auto z = terms::value{};
+        constexpr inline auto c = terms::constant{};
+
+        template<juliet::scalar Real, juliet::scalar Imag = 0.0_scalar>
+        constexpr inline auto num = terms::number<Real, Imag>{};
+
+        constexpr inline auto i = terms::number<0.0_scalar, 1.0_scalar>{};
+
+        template<terms::term Lhs, terms::term Rhs>
+        constexpr terms::sum<Lhs, Rhs> operator +(Lhs, Rhs) {
+            return {};
+        }
+
+        template<terms::term Lhs, terms::term Rhs>
+        constexpr terms::difference<Lhs, Rhs> operator -(Lhs, Rhs) {
+            return {};
+        }
+
+        template<terms::term Lhs, terms::term Rhs>
+        constexpr terms::product<Lhs, Rhs> operator *(Lhs, Rhs) {
+            return {};
+        }
+
+        template<terms::term Lhs, terms::term Rhs>
+        constexpr terms::quotient<Lhs, Rhs> operator /(Lhs, Rhs) {
+            return {};
+        }
+
+        template<terms::term Operand>
+        constexpr terms::negation<Operand> operator -(Operand) {
+            return {};
+        }
+
+        template<terms::term Operand>
+        constexpr terms::conjugate<Operand> conj(Operand) {
+            return {};
+        }
+
+        template<terms::term Operand>
+        constexpr terms::abs_components<Operand> abs_components(Operand) {
+            return {};
+        }
+
+        template<std::size_t Exponent, terms::term Base>
+        constexpr terms::power<Base, Exponent> pow(Base) {
+            return {};
+        }
+
+    }
+
+    namespace impl {
+
+        /* NOTE: Steps to the value of the formula, like our hand-written steps. */
+        template<juliet::terms::term Term>
+        struct term_step {
+            template<typename Value>
+            [[gnu::always_inline]]
+            static constexpr void operator ()(
+                Value &real,
+                Value &imag,
+
+                const Value &real_sq,
+                const Value &imag_sq,
+
+                const Value &constant_real,
+                const Value &constant_imag
+            ) {
+                const auto [next_real, next_imag] = Term::evaluate(impl::term_context<Value>{
+                    real,
+                    imag,
+
+                    real_sq,
+                    imag_sq,
+
+                    constant_real,
+                    constant_imag
+                });
+
+                real = next_real;
+                imag = next_imag;
+            }
+        };
+
+    }
+
+    /*
+        The set of numbers whose orbits under a formula written
+        in terms, like 'z*z*z + c', don't escape when starting
+        from zero, with the number as the constant.
+
+        NOTE: These are the same as our sets for the Burning Ship
+        and others, just with a step generated from the formula,
+        and so they get every engine those sets do.
+    */
+    template<juliet::terms::term auto Formula, juliet::periodicity_policy Periodicity = juliet::no_periodicity_check, typename Scalar = juliet::scalar>
+    using basic_compiled_formula_set = juliet::basic_escape_time_set<impl::term_step<decltype(Formula)>, Periodicity, Scalar>;
+
+    template<juliet::terms::term auto Formula>
+    using compiled_formula_set_t = juliet::basic_compiled_formula_set<Formula>;
+
+    template<juliet::terms::term auto Formula>
+    constexpr inline auto compiled_formula_set = juliet::compiled_formula_set_t<Formula>{};
+
+    template<juliet::terms::term auto Formula, typename Scalar>
+    using compiled_formula_set_for = juliet::basic_compiled_formula_set<Formula, juliet::no_periodicity_check, Scalar>;
+
+    static_assert(juliet::iterative_set<juliet::compiled_formula_set_t<terms::z * terms::z * terms::z + terms::c>>);
+    static_assert(juliet::batch_iterative_set<juliet::compiled_formula_set_t<terms::z * terms::z * terms::z + terms::c>, juliet::batch_width>);
+    static_assert(juliet::rescalable_set<juliet::compiled_formula_set_t<terms::z * terms::z * terms::z + terms::c>>);
+
+    namespace test {
+
+        namespace compiled {
+
+            using namespace juliet::terms;
+
+            static_assert(test::iterates_like<100>(juliet::compiled_formula_set<z*z + c>,                       test::unchecked_mandelbrot_set{}));
+            static_assert(test::iterates_like<100>(juliet::compiled_formula_set<pow<2>(z) + c>,                 test::unchecked_mandelbrot_set{}));
+            static_assert(test::iterates_like<100>(juliet::compiled_formula_set<z*z*z + c>,                     juliet::multibrot_set<3>));
+            static_assert(test::iterates_like<100>(juliet::compiled_formula_set<pow<5>(z) + c>,                 juliet::multibrot_set<5>));
+            static_assert(test::iterates_like<100>(juliet::compiled_formula_set<pow<2>(abs_components(z)) + c>, juliet::burning_ship_set));
+            static_assert(test::iterates_like<100>(juliet::compiled_formula_set<conj(z) * conj(z) + c>,         juliet::tricorn_set));
+
+            /* NOTE: Formulas which aren't squares of the orbit still agree with the same formula interpreted at runtime. */
+            static_assert(test::iterates_like<100>(
+                juliet::compiled_formula_set<(z*z - num<0.5_scalar>*z) / (z + num<1.5_scalar, 0.5_scalar>) + c>,
+
+                juliet::formula_set{juliet::formula::parse("(z*z - 0.5*z) / (z + (1.5 + 0.5i)) + c").value()}
+            ));
+
+        }
+
+    }
+
+}
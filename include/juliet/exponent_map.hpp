@@ -0,0 +1,77 @@
+#pragma once
+
+#include <juliet/common.hpp>
+#include <juliet/render.hpp>
+
+namespace juliet {
+
+    /*
+        Keeps the raw Lyapunov exponent of each pixel rather than
+        a color, so that it can be colored or analyzed afterwards.
+    */
+    template<typename Scalar = juliet::scalar>
+    struct basic_exponent_map: juliet::frame_renderer_interface {
+        using color      = std::float32_t;
+        using scalar     = Scalar;
+        using frame_type = juliet::basic_frame<Scalar>;
+
+        juliet::resolution _resolution;
+        frame_type         _frame;
+
+        std::size_t _max_iterations = juliet::frame_renderer_interface::max_iterations;
+
+        std::vector<color> _exponents;
+
+        constexpr explicit basic_exponent_map(const juliet::resolution resolution)
+        :
+            basic_exponent_map(resolution, frame_type::complete(resolution))
+        {}
+
+        constexpr basic_exponent_map(const juliet::resolution resolution, const frame_type &frame)
+        :
+            _resolution(resolution),
+            _frame(frame),
+            _exponents(resolution.area(), color{})
+        {}
+
+        constexpr std::span<const color> exponents(this const basic_exponent_map &self) {
+            return std::span(self._exponents);
+        }
+
+        constexpr juliet::resolution resolution(this const basic_exponent_map &self) {
+            return self._resolution;
+        }
+
+        constexpr frame_type frame(this const basic_exponent_map &self) {
+            return self._frame;
+        }
+
+        /* NOTE: This is how many terms each exponent is averaged over. */
+        constexpr std::size_t runtime_max_iterations(this const basic_exponent_map &self) {
+            return self._max_iterations;
+        }
+
+        /* NOTE: These get rounded up to the nearest of the 'precompiled_max_iterations'. */
+        constexpr void set_max_iterations(this basic_exponent_map &self, const std::size_t max_iterations) {
+            self._max_iterations = max_iterations;
+        }
+
+        constexpr color get_pixel(this const basic_exponent_map &self, const juliet::coords coords) {
+            return self._exponents[coords.y * self._resolution.width() + coords.x];
+        }
+
+        constexpr void set_pixel(this basic_exponent_map &self, const juliet::coords coords, const color exponent) {
+            self._exponents[coords.y * self._resolution.width() + coords.x] = exponent;
+        }
+
+        template<std::size_t NumTerms>
+        static constexpr color color_for_exponent(const std::float32_t exponent) {
+            return exponent;
+        }
+    };
+
+    using exponent_map = juliet::basic_exponent_map<>;
+
+    static_assert(juliet::lyapunov_frame_renderer<juliet::exponent_map>);
+
+}
@@ -0,0 +1,174 @@
+#pragma once
+
+#include <juliet/common.hpp>
+#include <juliet/multi_double.hpp>
+
+namespace juliet {
+
+    /*
+        A signed number held in a 64-bit integer with a fixed
+        number of bits after the point, multiplied through
+        128-bit integers.
+
+        Integer arithmetic rounds the same way on every compiler
+        and processor, regardless of FMA contraction or fast-math
+        flags, so renders with this scalar are bit-for-bit
+        reproducible. Near the origin it also carries a few more
+        bits than a double, for moderately deep zooms.
+
+        NOTE: Results which don't fit saturate instead of wrapping,
+        so that an orbit which runs off still compares as escaped.
+        The derivatives of distance estimation quickly grow past
+        our range, so this is only meant for counting escapes.
+    */
+    struct fixed_point {
+        /* NOTE: Enough integer bits for the squares of orbits just past our escape radius of 2. */
+        static constexpr int fraction_bits = 56;
+
+        /* NOTE: The bits of precision we carry for numbers around 2, which is what the precision of a frame is measured against. */
+        static constexpr std::size_t digits = fraction_bits + 2;
+
+        static constexpr auto One = std::int64_t{1} << fraction_bits;
+
+        std::int64_t bits = 0;
+
+        constexpr fixed_point() = default;
+
+        constexpr fixed_point(const std::float64_t value) : bits(fixed_point::_saturate_scaled(value * static_cast<std::float64_t>(One))) {}
+
+        template<std::integral Integer>
+        constexpr explicit fixed_point(const Integer value) : fixed_point(static_cast<std::float64_t>(value)) {}
+
+        /* NOTE: Each component is rounded on its own, which is still exact enough and still the same everywhere. */
+        template<std::size_t N>
+        constexpr explicit fixed_point(const juliet::multi_double<N> &value) {
+            for (const auto component : value.components) {
+                *this += fixed_point(component);
+            }
+        }
+
+        static constexpr fixed_point _from_bits(const std::int64_t bits) {
+            auto result = fixed_point{};
+
+            result.bits = bits;
+
+            return result;
+        }
+
+        static constexpr std::int64_t _saturate_scaled(const std::float64_t scaled) {
+            static constexpr auto Limit = 0x1p63f64;
+
+            /* NOTE: NaNs fail both of these, and so become zero below. */
+            if (scaled >= Limit) {
+                return std::numeric_limits<std::int64_t>::max();
+            }
+
+            if (scaled < -Limit) {
+                return std::numeric_limits<std::int64_t>::min();
+            }
+
+            if (!(scaled == scaled)) {
+                return 0;
+            }
+
+            return static_cast<std::int64_t>(std::round(scaled));
+        }
+
+        static constexpr std::int64_t _saturate(const impl::int128 value) {
+            return static_cast<std::int64_t>(std::clamp<impl::int128>(
+                value,
+
+                std::numeric_limits<std::int64_t>::min(),
+                std::numeric_limits<std::int64_t>::max()
+            ));
+        }
+
+        template<std::floating_point Float>
+        constexpr explicit operator Float(this const fixed_point self) {
+            /* NOTE: Scaling by a power of two is exact, so the only rounding is in converting the integer. */
+            return static_cast<Float>(static_cast<std::float64_t>(self.bits) * (1.0f64 / static_cast<std::float64_t>(One)));
+        }
+
+        constexpr fixed_point operator -(this const fixed_point self) {
+            return fixed_point::_from_bits(fixed_point::_saturate(-impl::int128{self.bits}));
+        }
+
+        friend constexpr fixed_point abs(const fixed_point value) {
+            if (value.bits < 0) {
+                return -value;
+            }
+
+            return value;
+        }
+
+        friend constexpr fixed_point operator +(const fixed_point lhs, const fixed_point rhs) {
+            return fixed_point::_from_bits(fixed_point::_saturate(impl::int128{lhs.bits} + rhs.bits));
+        }
+
+        friend constexpr fixed_point operator -(const fixed_point lhs, const fixed_point rhs) {
+            return fixed_point::_from_bits(fixed_point::_saturate(impl::int128{lhs.bits} - rhs.bits));
+        }
+
+        friend constexpr fixed_point operator *(const fixed_point lhs, const fixed_point rhs) {
+            static constexpr auto Half = impl::int128{1} << (fraction_bits - 1);
+
+            /* NOTE: Rounding to nearest, with ties towards positive infinity since the shift is arithmetic. */
+            const auto product = impl::int128{lhs.bits} * rhs.bits;
+
+            return fixed_point::_from_bits(fixed_point::_saturate((product + Half) >> fraction_bits));
+        }
+
+        friend constexpr fixed_point operator /(const fixed_point lhs, const fixed_point rhs) {
+            if (rhs.bits == 0) {
+                if (lhs.bits == 0) {
+                    return {};
+                }
+
+                return fixed_point::_from_bits(lhs.bits < 0 ? std::numeric_limits<std::int64_t>::min() : std::numeric_limits<std::int64_t>::max());
+            }
+
+            /* NOTE: This fits, as we only have 64 bits to shift up by 56. */
+            return fixed_point::_from_bits(fixed_point::_saturate((impl::int128{lhs.bits} << fraction_bits) / rhs.bits));
+        }
+
+        constexpr fixed_point &operator +=(this fixed_point &self, const fixed_point rhs) {
+            return self = self + rhs;
+        }
+
+        constexpr fixed_point &operator -=(this fixed_point &self, const fixed_point rhs) {
+            return self = self - rhs;
+        }
+
+        constexpr fixed_point &operator *=(this fixed_point &self, const fixed_point rhs) {
+            return self = self * rhs;
+        }
+
+        constexpr fixed_point &operator /=(this fixed_point &self, const fixed_point rhs) {
+            return self = self / rhs;
+        }
+
+        friend constexpr bool operator ==(const fixed_point lhs, const fixed_point rhs) = default;
+
+        friend constexpr std::strong_ordering operator <=>(const fixed_point lhs, const fixed_point rhs) = default;
+    };
+
+    namespace test {
+
+        static_assert(juliet::fixed_point(3.0f64) * juliet::fixed_point(0.5f64) == juliet::fixed_point(1.5f64));
+        static_assert(juliet::fixed_point(1.0f64) / juliet::fixed_point(4.0f64) == juliet::fixed_point(0.25f64));
+        static_assert(juliet::fixed_point(-2.0f64) < juliet::fixed_point(1.0f64));
+        static_assert(static_cast<std::float64_t>(juliet::fixed_point(-0.375f64)) == -0.375f64);
+        static_assert(abs(juliet::fixed_point(-0.375f64)) == juliet::fixed_point(0.375f64));
+
+        /* Past where a double can tell the difference. */
+        static_assert(juliet::fixed_point(1.0f64) + juliet::fixed_point(0x1p-55f64) != juliet::fixed_point(1.0f64));
+        static_assert(juliet::fixed_point(juliet::double_double(1.0f64) + juliet::double_double(0x1p-55f64)) == juliet::fixed_point(1.0f64) + juliet::fixed_point(0x1p-55f64));
+
+        /* NOTE: Overflowing saturates, so escaped orbits stay escaped. */
+        static_assert(juliet::fixed_point(100.0f64) * juliet::fixed_point(100.0f64) > juliet::fixed_point(4.0f64));
+        static_assert(juliet::fixed_point(-100.0f64) * juliet::fixed_point(100.0f64) < juliet::fixed_point(-4.0f64));
+        static_assert(juliet::fixed_point(1e300_scalar) + juliet::fixed_point(1.0f64) > juliet::fixed_point(100.0f64));
+
+    }
+
+}
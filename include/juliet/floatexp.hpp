@@ -0,0 +1,224 @@
+#pragma once
+
+#include <juliet/common.hpp>
+
+namespace juliet {
+
+    /*
+        A scalar mantissa with its own 64-bit exponent, for
+        numbers far smaller (or larger) than scalars can hold.
+
+        This only has the range of a bigger float and not
+        the precision, and so is for deltas and derivatives
+        which only need to be precise relative to themselves.
+    */
+    struct floatexp {
+        static constexpr std::int64_t MantissaBits = std::numeric_limits<juliet::scalar>::digits - 1;
+        static constexpr std::int64_t ExponentBias = std::numeric_limits<juliet::scalar>::max_exponent - 1;
+
+        static constexpr std::uint64_t ExponentMask = (std::uint64_t{1} << (64 - 1 - MantissaBits)) - 1;
+
+        /* NOTE: Small enough that zero loses every comparison of exponents, but far from overflowing when summed. */
+        static constexpr std::int64_t ZeroExponent = std::numeric_limits<std::int64_t>::min() / 4;
+
+        /* NOTE: Likewise large enough that infinities and NaNs win every comparison of exponents. */
+        static constexpr std::int64_t NonFiniteExponent = std::numeric_limits<std::int64_t>::max() / 4;
+
+        /* NOTE: Either zero, infinite, NaN, or with a magnitude in '[1, 2)'. */
+        juliet::scalar mantissa = 0;
+        std::int64_t   exponent = ZeroExponent;
+
+        constexpr floatexp() = default;
+
+        constexpr floatexp(const juliet::scalar value) : floatexp(floatexp::from_parts(value, 0)) {}
+
+        /* NOTE: Builds '2^exponent' straight from its bits, so 'exponent' must be in the normal range of scalars. */
+        static constexpr juliet::scalar _power_of_two(const std::int64_t exponent) {
+            return std::bit_cast<juliet::scalar>(static_cast<std::uint64_t>(exponent + ExponentBias) << MantissaBits);
+        }
+
+        /*
+            Returns 'mantissa * 2^exponent'.
+
+            NOTE: This normalizes by moving the mantissa's
+            exponent bits over to 'exponent', which unlike
+            'std::frexp' is only a few integer operations.
+            Infinite and NaN mantissas have no exponent to
+            move, and so are kept as they are.
+        */
+        static constexpr floatexp from_parts(juliet::scalar mantissa, std::int64_t exponent) {
+            if (mantissa == 0) {
+                return floatexp{};
+            }
+
+            auto bits   = std::bit_cast<std::uint64_t>(mantissa);
+            auto biased = static_cast<std::int64_t>((bits >> MantissaBits) & ExponentMask);
+
+            if (biased == static_cast<std::int64_t>(ExponentMask)) {
+                auto result = floatexp{};
+
+                result.mantissa = mantissa;
+                result.exponent = NonFiniteExponent;
+
+                return result;
+            }
+
+            /* NOTE: Subnormal mantissas have no implicit leading bit, so we scale them up to be normal first. */
+            if (biased == 0) {
+                mantissa *= floatexp::_power_of_two(MantissaBits + 1);
+                exponent -= MantissaBits + 1;
+
+                bits   = std::bit_cast<std::uint64_t>(mantissa);
+                biased = static_cast<std::int64_t>((bits >> MantissaBits) & ExponentMask);
+            }
+
+            bits &= ~(ExponentMask << MantissaBits);
+            bits |= static_cast<std::uint64_t>(ExponentBias) << MantissaBits;
+
+            auto result = floatexp{};
+
+            result.mantissa = std::bit_cast<juliet::scalar>(bits);
+            result.exponent = exponent + biased - ExponentBias;
+
+            return result;
+        }
+
+        constexpr bool is_zero(this const floatexp self) {
+            return self.mantissa == 0;
+        }
+
+        /* Returns ourselves multiplied by '2^exponent'. */
+        constexpr floatexp scaled(this floatexp self, const std::int64_t exponent) {
+            if (!self.is_zero()) {
+                self.exponent += exponent;
+            }
+
+            return self;
+        }
+
+        /* NOTE: Rounds to zero or infinity when out of the range of scalars. */
+        constexpr explicit operator juliet::scalar(this const floatexp self) {
+            /* NOTE: Anything past this already rounds to zero or infinity. */
+            static constexpr auto MaxExponent = 2 * (ExponentBias - 1);
+
+            const auto exponent = std::clamp(self.exponent, -MaxExponent, MaxExponent);
+
+            /* NOTE: Splitting the exponent in two keeps each power of two in the normal range. */
+            const auto first_half = exponent / 2;
+
+            return self.mantissa * floatexp::_power_of_two(first_half) * floatexp::_power_of_two(exponent - first_half);
+        }
+
+        constexpr floatexp operator -(this floatexp self) {
+            self.mantissa = -self.mantissa;
+
+            return self;
+        }
+
+        friend constexpr floatexp abs(floatexp value) {
+            value.mantissa = std::abs(value.mantissa);
+
+            return value;
+        }
+
+        /* Returns the base-2 logarithm of our magnitude, which unlike ourselves always fits in a scalar. */
+        friend constexpr juliet::scalar log2(const floatexp value) {
+            return static_cast<juliet::scalar>(value.exponent) + std::log2(std::abs(value.mantissa));
+        }
+
+        friend constexpr floatexp operator +(const floatexp lhs, const floatexp rhs) {
+            const auto lhs_is_larger = (lhs.exponent >= rhs.exponent);
+
+            const auto larger  = lhs_is_larger ? lhs : rhs;
+            const auto smaller = lhs_is_larger ? rhs : lhs;
+
+            const auto difference = larger.exponent - smaller.exponent;
+
+            /* NOTE: Past this the smaller number can't affect the larger one's mantissa. */
+            if (difference > MantissaBits + 1) {
+                return larger;
+            }
+
+            return floatexp::from_parts(
+                larger.mantissa + smaller.mantissa * floatexp::_power_of_two(-difference),
+
+                larger.exponent
+            );
+        }
+
+        friend constexpr floatexp operator -(const floatexp lhs, const floatexp rhs) {
+            return lhs + -rhs;
+        }
+
+        friend constexpr floatexp operator *(const floatexp lhs, const floatexp rhs) {
+            return floatexp::from_parts(lhs.mantissa * rhs.mantissa, lhs.exponent + rhs.exponent);
+        }
+
+        friend constexpr floatexp operator /(const floatexp lhs, const floatexp rhs) {
+            return floatexp::from_parts(lhs.mantissa / rhs.mantissa, lhs.exponent - rhs.exponent);
+        }
+
+        constexpr floatexp &operator +=(this floatexp &self, const floatexp rhs) {
+            return self = self + rhs;
+        }
+
+        constexpr floatexp &operator -=(this floatexp &self, const floatexp rhs) {
+            return self = self - rhs;
+        }
+
+        constexpr floatexp &operator *=(this floatexp &self, const floatexp rhs) {
+            return self = self * rhs;
+        }
+
+        constexpr floatexp &operator /=(this floatexp &self, const floatexp rhs) {
+            return self = self / rhs;
+        }
+
+        friend constexpr bool operator ==(const floatexp lhs, const floatexp rhs) {
+            return lhs.mantissa == rhs.mantissa && (lhs.exponent == rhs.exponent || lhs.is_zero());
+        }
+
+        friend constexpr std::partial_ordering operator <=>(const floatexp lhs, const floatexp rhs) {
+            return (lhs - rhs).mantissa <=> 0.0_scalar;
+        }
+    };
+
+    namespace test {
+
+        static_assert(juliet::floatexp(0.0_scalar).is_zero());
+
+        static_assert(juliet::floatexp(3.0_scalar).mantissa == 1.5_scalar);
+        static_assert(juliet::floatexp(3.0_scalar).exponent == 1);
+
+        static_assert(static_cast<juliet::scalar>(juliet::floatexp(-0.375_scalar)) == -0.375_scalar);
+
+        static_assert(juliet::floatexp(3.0_scalar) + juliet::floatexp(-1.0_scalar) == juliet::floatexp(2.0_scalar));
+        static_assert(juliet::floatexp(1.0_scalar) - juliet::floatexp(1.0_scalar) == juliet::floatexp{});
+
+        /* Well past where scalars would underflow to zero. */
+        static_assert(juliet::floatexp::from_parts(1.0_scalar, -2000) * juliet::floatexp::from_parts(1.0_scalar, -2000) == juliet::floatexp::from_parts(1.0_scalar, -4000));
+        static_assert(juliet::floatexp::from_parts(1.0_scalar, -2000) + juliet::floatexp::from_parts(1.0_scalar, -2001) == juliet::floatexp::from_parts(1.5_scalar, -2000));
+        static_assert(juliet::floatexp::from_parts(1.0_scalar, -2000) / juliet::floatexp::from_parts(1.0_scalar, -2010) == juliet::floatexp(1024.0_scalar));
+
+        static_assert(log2(juliet::floatexp::from_parts(-1.0_scalar, -2000)) == -2000);
+
+        static_assert(juliet::floatexp::from_parts(1.0_scalar, -2000) < juliet::floatexp::from_parts(1.0_scalar, -1999));
+        static_assert(juliet::floatexp::from_parts(-1.0_scalar, -2000) < juliet::floatexp{});
+
+        static_assert(static_cast<juliet::scalar>(juliet::floatexp::from_parts(1.0_scalar, -2000)) == 0);
+
+        /* Subnormals are normalized too. */
+        static_assert(juliet::floatexp(std::numeric_limits<juliet::scalar>::denorm_min()).exponent == -1074);
+        static_assert(juliet::floatexp(std::numeric_limits<juliet::scalar>::denorm_min()).mantissa == 1);
+
+        /* Infinities and NaNs are kept rather than normalized into finite numbers. */
+        static_assert(static_cast<juliet::scalar>(juliet::floatexp( std::numeric_limits<juliet::scalar>::infinity())) ==  std::numeric_limits<juliet::scalar>::infinity());
+        static_assert(static_cast<juliet::scalar>(juliet::floatexp(-std::numeric_limits<juliet::scalar>::infinity())) == -std::numeric_limits<juliet::scalar>::infinity());
+        static_assert(std::isnan(juliet::floatexp(std::numeric_limits<juliet::scalar>::quiet_NaN()).mantissa));
+
+        static_assert(juliet::floatexp::from_parts(std::numeric_limits<juliet::scalar>::infinity(), -2000) > juliet::floatexp::from_parts(1.0_scalar, 2000));
+        static_assert(juliet::floatexp::from_parts(1.0_scalar, 2000) * juliet::floatexp(std::numeric_limits<juliet::scalar>::infinity()) == juliet::floatexp(std::numeric_limits<juliet::scalar>::infinity()));
+
+    }
+
+}
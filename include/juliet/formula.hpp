@@ -0,0 +1,686 @@
+#pragma once
+
+#include <juliet/common.hpp>
+#include <juliet/simd.hpp>
+#include <juliet/sets.hpp>
+
+namespace juliet {
+
+    enum class formula_op : std::uint8_t {
+        add,
+        subtract,
+        multiply,
+        divide,
+        negate,
+        square,
+        conjugate,
+
+        /* NOTE: Takes the absolute value of each part separately, as for the Burning Ship. */
+        abs_components,
+
+        real,
+        imag,
+        norm,
+    };
+
+    /* NOTE: Unary operations ignore their 'rhs'. */
+    struct formula_instruction {
+        juliet::formula_op op;
+
+        std::uint8_t destination;
+        std::uint8_t lhs;
+        std::uint8_t rhs;
+    };
+
+    struct formula_constant {
+        std::uint8_t    destination;
+        juliet::complex value;
+    };
+
+    struct formula_error {
+        /* NOTE: Of the character in the source where the formula stopped making sense. */
+        std::size_t position;
+
+        std::string_view message;
+    };
+
+    /*
+        An expression over 'z' and 'c', parsed at runtime into
+        bytecode for a machine with a register for each value.
+
+        NOTE: Evaluating the bytecode over whole vectors of numbers
+        means the cost of dispatching each instruction is shared
+        between every lane, instead of being paid for every number.
+    */
+    struct formula {
+        static constexpr std::size_t MaxRegisters = 64;
+
+        /* NOTE: The registers which hold the inputs, which are followed by constants and intermediate values. */
+        static constexpr std::uint8_t ValueRegister    = 0;
+        static constexpr std::uint8_t ConstantRegister = 1;
+
+        std::vector<juliet::formula_constant>    constants;
+        std::vector<juliet::formula_instruction> instructions;
+
+        std::uint8_t result_register = ValueRegister;
+
+        /*
+            Parses formulas like 'z^2 + c', made of:
+
+            - The variables 'z' and 'c', and the imaginary unit 'i'.
+            - Real numbers, which can be followed by 'i' to make them imaginary.
+            - The operators '+', '-', '*', '/', and '^' with a whole exponent.
+            - The functions 're', 'im', 'conj', 'norm', and 'abs_components'.
+            - Parentheses.
+        */
+        static constexpr std::expected<formula, juliet::formula_error> parse(std::string_view source);
+
+        /* NOTE: Evaluates the formula, leaving its value in the 'ValueRegister', for plain scalars or for vectors. */
+        template<typename Value>
+        [[gnu::always_inline]]
+        constexpr void evaluate(
+            this const formula &self,
+
+            std::array<Value, MaxRegisters> &real,
+            std::array<Value, MaxRegisters> &imag
+        ) {
+            for (const auto &instruction : self.instructions) {
+                const auto lhs_real = real[instruction.lhs];
+                const auto lhs_imag = imag[instruction.lhs];
+
+                const auto rhs_real = real[instruction.rhs];
+                const auto rhs_imag = imag[instruction.rhs];
+
+                auto &result_real = real[instruction.destination];
+                auto &result_imag = imag[instruction.destination];
+
+                switch (instruction.op) {
+                    case juliet::formula_op::add: {
+                        result_real = lhs_real + rhs_real;
+                        result_imag = lhs_imag + rhs_imag;
+                    } break;
+
+                    case juliet::formula_op::subtract: {
+                        result_real = lhs_real - rhs_real;
+                        result_imag = lhs_imag - rhs_imag;
+                    } break;
+
+                    case juliet::formula_op::multiply: {
+                        result_real = lhs_real * rhs_real - lhs_imag * rhs_imag;
+                        result_imag = lhs_real * rhs_imag + lhs_imag * rhs_real;
+                    } break;
+
+                    case juliet::formula_op::divide: {
+                        const auto denominator = rhs_real * rhs_real + rhs_imag * rhs_imag;
+
+                        result_real = (lhs_real * rhs_real + lhs_imag * rhs_imag) / denominator;
+                        result_imag = (lhs_imag * rhs_real - lhs_real * rhs_imag) / denominator;
+                    } break;
+
+                    case juliet::formula_op::negate: {
+                        result_real = -lhs_real;
+                        result_imag = -lhs_imag;
+                    } break;
+
+                    case juliet::formula_op::square: {
+                        /* NOTE: The same as 'impl::quadratic_step', so that formulas agree exactly with our own sets. */
+                        result_real = lhs_real * lhs_real - lhs_imag * lhs_imag;
+                        result_imag = (lhs_real + lhs_real) * lhs_imag;
+                    } break;
+
+                    case juliet::formula_op::conjugate: {
+                        result_real = lhs_real;
+                        result_imag = -lhs_imag;
+                    } break;
+
+                    case juliet::formula_op::abs_components: {
+                        result_real = simd::abs(lhs_real);
+                        result_imag = simd::abs(lhs_imag);
+                    } break;
+
+                    case juliet::formula_op::real: {
+                        result_real = lhs_real;
+                        result_imag = Value{};
+                    } break;
+
+                    case juliet::formula_op::imag: {
+                        result_real = lhs_imag;
+                        result_imag = Value{};
+                    } break;
+
+                    case juliet::formula_op::norm: {
+                        result_real = lhs_real * lhs_real + lhs_imag * lhs_imag;
+                        result_imag = Value{};
+                    } break;
+                }
+            }
+
+            real[ValueRegister] = real[self.result_register];
+            imag[ValueRegister] = imag[self.result_register];
+        }
+
+        /* NOTE: Sets up the registers for the start of an orbit. */
+        template<typename Value>
+        [[gnu::always_inline]]
+        constexpr void load(
+            this const formula &self,
+
+            std::array<Value, MaxRegisters> &real,
+            std::array<Value, MaxRegisters> &imag,
+
+            const Value &value_real,
+            const Value &value_imag,
+
+            const Value &constant_real,
+            const Value &constant_imag
+        ) {
+            real[ValueRegister] = value_real;
+            imag[ValueRegister] = value_imag;
+
+            real[ConstantRegister] = constant_real;
+            imag[ConstantRegister] = constant_imag;
+
+            for (const auto &constant : self.constants) {
+                real[constant.destination] = simd::broadcast<Value>(constant.value.real());
+                imag[constant.destination] = simd::broadcast<Value>(constant.value.imag());
+            }
+        }
+    };
+
+    namespace impl {
+
+        /* NOTE: Recursive descent, emitting instructions as soon as the values they need have registers. */
+        struct formula_parser {
+            std::string_view source;
+            std::size_t      position = 0;
+
+            juliet::formula result = {};
+
+            std::uint8_t next_register = juliet::formula::ConstantRegister + 1;
+
+            /*
+                NOTE: Parentheses take no registers, and so nesting
+                is bounded separately, so that deeply nested formulas
+                are an error rather than overflowing the stack.
+            */
+            static constexpr std::size_t MaxDepth = 32;
+
+            std::size_t depth = 0;
+
+            using register_or_error = std::expected<std::uint8_t, juliet::formula_error>;
+
+            static constexpr bool is_digit(const char character) {
+                return character >= '0' && character <= '9';
+            }
+
+            static constexpr bool is_identifier_character(const char character) {
+                return (
+                    (character >= 'a' && character <= 'z') ||
+                    (character >= 'A' && character <= 'Z') ||
+
+                    character == '_' ||
+
+                    formula_parser::is_digit(character)
+                );
+            }
+
+            constexpr std::unexpected<juliet::formula_error> error(this const formula_parser &self, const std::string_view message) {
+                return std::unexpected(juliet::formula_error{self.position, message});
+            }
+
+            constexpr void skip_whitespace(this formula_parser &self) {
+                while (self.position < self.source.size() && (self.source[self.position] == ' ' || self.source[self.position] == '\t')) {
+                    ++self.position;
+                }
+            }
+
+            constexpr char peek(this formula_parser &self) {
+                self.skip_whitespace();
+
+                if (self.position >= self.source.size()) {
+                    return '\0';
+                }
+
+                return self.source[self.position];
+            }
+
+            constexpr register_or_error allocate(this formula_parser &self) {
+                if (self.next_register >= juliet::formula::MaxRegisters) {
+                    return self.error("formula needs too many registers");
+                }
+
+                const auto allocated = self.next_register;
+                ++self.next_register;
+
+                return allocated;
+            }
+
+            constexpr register_or_error constant(this formula_parser &self, const juliet::complex value) {
+                const auto destination = self.allocate();
+                if (destination.has_value()) {
+                    self.result.constants.push_back({*destination, value});
+                }
+
+                return destination;
+            }
+
+            constexpr register_or_error emit(this formula_parser &self, const juliet::formula_op op, const std::uint8_t lhs, const std::uint8_t rhs = 0) {
+                const auto destination = self.allocate();
+                if (destination.has_value()) {
+                    self.result.instructions.push_back({op, *destination, lhs, rhs});
+                }
+
+                return destination;
+            }
+
+            /* NOTE: Scaling by powers of ten like this can be off by an ulp, which doesn't matter for writing formulas. */
+            constexpr juliet::scalar number(this formula_parser &self) {
+                auto value = 0.0_scalar;
+                while (self.position < self.source.size() && formula_parser::is_digit(self.source[self.position])) {
+                    value = 10.0_scalar * value + static_cast<juliet::scalar>(self.source[self.position] - '0');
+
+                    ++self.position;
+                }
+
+                if (self.position < self.source.size() && self.source[self.position] == '.') {
+                    ++self.position;
+
+                    auto scale = 0.1_scalar;
+                    while (self.position < self.source.size() && formula_parser::is_digit(self.source[self.position])) {
+                        value += scale * static_cast<juliet::scalar>(self.source[self.position] - '0');
+                        scale /= 10.0_scalar;
+
+                        ++self.position;
+                    }
+                }
+
+                return value;
+            }
+
+            constexpr std::string_view identifier(this formula_parser &self) {
+                const auto start = self.position;
+
+                while (self.position < self.source.size() && formula_parser::is_identifier_character(self.source[self.position])) {
+                    ++self.position;
+                }
+
+                return self.source.substr(start, self.position - start);
+            }
+
+            constexpr register_or_error primary(this formula_parser &self) {
+                const auto next = self.peek();
+
+                if (formula_parser::is_digit(next) || next == '.') {
+                    const auto value = self.number();
+
+                    /* NOTE: A number directly followed by 'i' is imaginary. */
+                    if (self.position < self.source.size() && self.source[self.position] == 'i' && (self.position + 1 >= self.source.size() || !formula_parser::is_identifier_character(self.source[self.position + 1]))) {
+                        ++self.position;
+
+                        return self.constant({0.0_scalar, value});
+                    }
+
+                    return self.constant({value, 0.0_scalar});
+                }
+
+                if (next == '(') {
+                    ++self.position;
+
+                    const auto inner = self.expression();
+                    if (!inner.has_value()) {
+                        return inner;
+                    }
+
+                    if (self.peek() != ')') {
+                        return self.error("expected ')'");
+                    }
+
+                    ++self.position;
+
+                    return inner;
+                }
+
+                const auto start = self.position;
+                const auto name  = self.identifier();
+
+                if (name == "z") {
+                    return juliet::formula::ValueRegister;
+                }
+
+                if (name == "c") {
+                    return juliet::formula::ConstantRegister;
+                }
+
+                if (name == "i") {
+                    return self.constant({0.0_scalar, 1.0_scalar});
+                }
+
+                static constexpr auto Functions = std::array{
+                    std::pair{std::string_view("re"),             juliet::formula_op::real},
+                    std::pair{std::string_view("im"),             juliet::formula_op::imag},
+                    std::pair{std::string_view("conj"),           juliet::formula_op::conjugate},
+                    std::pair{std::string_view("norm"),           juliet::formula_op::norm},
+                    std::pair{std::string_view("abs_components"), juliet::formula_op::abs_components},
+                };
+
+                const auto function = std::ranges::find(Functions, name, &std::pair<std::string_view, juliet::formula_op>::first);
+                if (name.empty() || function == Functions.end()) {
+                    self.position = start;
+
+                    return self.error("expected a number, variable, function, or '('");
+                }
+
+                if (self.peek() != '(') {
+                    return self.error("expected '(' after function");
+                }
+
+                ++self.position;
+
+                const auto argument = self.expression();
+                if (!argument.has_value()) {
+                    return argument;
+                }
+
+                if (self.peek() != ')') {
+                    return self.error("expected ')'");
+                }
+
+                ++self.position;
+
+                return self.emit(function->second, *argument);
+            }
+
+            /* NOTE: Raises by squaring, so that e.g. 'z^2' is a single square. */
+            constexpr register_or_error power(this formula_parser &self) {
+                const auto base = self.primary();
+                if (!base.has_value() || self.peek() != '^') {
+                    return base;
+                }
+
+                ++self.position;
+                self.skip_whitespace();
+
+                if (self.position >= self.source.size() || !formula_parser::is_digit(self.source[self.position])) {
+                    return self.error("expected a whole exponent");
+                }
+
+                const auto exponent_start = self.position;
+                const auto exponent       = self.number();
+
+                if (exponent != std::floor(exponent) || exponent < 1.0_scalar || exponent > 64.0_scalar) {
+                    self.position = exponent_start;
+
+                    return self.error("exponent must be a whole number from 1 to 64");
+                }
+
+                auto remaining = static_cast<std::size_t>(exponent);
+
+                auto squared = *base;
+                auto result  = std::optional<std::uint8_t>{};
+
+                while (true) {
+                    if (remaining % 2 == 1) {
+                        if (result.has_value()) {
+                            const auto product = self.emit(juliet::formula_op::multiply, *result, squared);
+                            if (!product.has_value()) {
+                                return product;
+                            }
+
+                            result = *product;
+                        } else {
+                            result = squared;
+                        }
+                    }
+
+                    remaining /= 2;
+                    if (remaining == 0) {
+                        return *result;
+                    }
+
+                    const auto next_squared = self.emit(juliet::formula_op::square, squared);
+                    if (!next_squared.has_value()) {
+                        return next_squared;
+                    }
+
+                    squared = *next_squared;
+                }
+            }
+
+            /* NOTE: Every way of nesting passes through here, and so this is where we bound it. */
+            constexpr register_or_error unary(this formula_parser &self) {
+                if (self.depth >= formula_parser::MaxDepth) {
+                    return self.error("too deeply nested");
+                }
+
+                ++self.depth;
+                const auto result = self.negation();
+                --self.depth;
+
+                return result;
+            }
+
+            constexpr register_or_error negation(this formula_parser &self) {
+                if (self.peek() == '-') {
+                    ++self.position;
+
+                    const auto operand = self.unary();
+                    if (!operand.has_value()) {
+                        return operand;
+                    }
+
+                    return self.emit(juliet::formula_op::negate, *operand);
+                }
+
+                return self.power();
+            }
+
+            constexpr register_or_error binary(this formula_parser &self, const auto &operand, const char first, const juliet::formula_op first_op, const char second, const juliet::formula_op second_op) {
+                auto lhs = operand();
+                if (!lhs.has_value()) {
+                    return lhs;
+                }
+
+                while (true) {
+                    const auto next = self.peek();
+                    if (next != first && next != second) {
+                        return lhs;
+                    }
+
+                    ++self.position;
+
+                    const auto rhs = operand();
+                    if (!rhs.has_value()) {
+                        return rhs;
+                    }
+
+                    lhs = self.emit((next == first) ? first_op : second_op, *lhs, *rhs);
+                    if (!lhs.has_value()) {
+                        return lhs;
+                    }
+                }
+            }
+
+            constexpr register_or_error term(this formula_parser &self) {
+                return self.binary([&]() { return self.unary(); }, '*', juliet::formula_op::multiply, '/', juliet::formula_op::divide);
+            }
+
+            constexpr register_or_error expression(this formula_parser &self) {
+                return self.binary([&]() { return self.term(); }, '+', juliet::formula_op::add, '-', juliet::formula_op::subtract);
+            }
+        };
+
+    }
+
+    constexpr std::expected<formula, juliet::formula_error> formula::parse(const std::string_view source) {
+        auto parser = impl::formula_parser{source};
+
+        const auto result_register = parser.expression();
+        if (!result_register.has_value()) {
+            return std::unexpected(result_register.error());
+        }
+
+        if (parser.peek() != '\0') {
+            return parser.error("expected an operator");
+        }
+
+        parser.result.result_register = *result_register;
+
+        return std::move(parser.result);
+    }
+
+    /*
+        The set of numbers whose orbits under a formula don't escape,
+        for trying out new fractals without having to recompile.
+
+        With no 'julia_constant', each number is used as 'c' with
+        orbits starting from zero, as for the Mandelbrot set. With
+        one, each number is instead where its orbit starts, with
+        the Julia constant as 'c'.
+    */
+    template<typename Scalar = juliet::scalar>
+    struct basic_formula_set {
+        using scalar = Scalar;
+
+        juliet::formula formula;
+
+        std::optional<juliet::complex> julia_constant = std::nullopt;
+
+        juliet::scalar escape_radius = 2.0_scalar;
+
+        template<typename OtherScalar>
+        constexpr basic_formula_set<OtherScalar> with_scalar(this const basic_formula_set &self) {
+            return {self.formula, self.julia_constant, self.escape_radius};
+        }
+
+        /* Where the orbit of the number starts, and its constant. */
+        template<typename Value>
+        constexpr std::array<Value, 4> _orbit_start(this const basic_formula_set &self, const Value &real, const Value &imag) {
+            if (self.julia_constant.has_value()) {
+                return {
+                    real,
+                    imag,
+
+                    simd::broadcast<Value>(self.julia_constant->real()),
+                    simd::broadcast<Value>(self.julia_constant->imag())
+                };
+            }
+
+            return {Value{}, Value{}, real, imag};
+        }
+
+        template<std::size_t MaxIterations>
+        constexpr std::size_t iterations_before_escape(this const basic_formula_set &self, const juliet::complex_for<Scalar> &num) {
+            const auto escape_magnitude_sq = static_cast<Scalar>(self.escape_radius * self.escape_radius);
+
+            const auto [start_real, start_imag, constant_real, constant_imag] = self._orbit_start(num.real(), num.imag());
+
+            auto real = std::array<Scalar, juliet::formula::MaxRegisters>{};
+            auto imag = std::array<Scalar, juliet::formula::MaxRegisters>{};
+
+            self.formula.load(real, imag, start_real, start_imag, constant_real, constant_imag);
+
+            for (const auto i : std::views::iota(0uz, MaxIterations)) {
+                self.formula.evaluate(real, imag);
+
+                const auto value_real = real[juliet::formula::ValueRegister];
+                const auto value_imag = imag[juliet::formula::ValueRegister];
+
+                /* NOTE: Formulas can divide by zero, and so orbits which become NaN count as escaped. */
+                if (!(value_real * value_real + value_imag * value_imag <= escape_magnitude_sq)) {
+                    return i;
+                }
+            }
+
+            return MaxIterations;
+        }
+
+        template<std::size_t MaxIterations, std::size_t Width>
+        requires (std::has_single_bit(Width) && simd::vectorizable<Scalar>)
+        constexpr juliet::iterations_batch<Width> iterations_before_escape(this const basic_formula_set &self, const juliet::complex_batch<Width, Scalar> &nums) {
+            return impl::iterate_batch(nums, [&self]<typename Vector>(const Vector &num_real, const Vector &num_imag) {
+                using Mask = simd::mask_for<Vector>;
+
+                const auto escape_magnitude_sq = simd::broadcast<Vector>(self.escape_radius * self.escape_radius);
+
+                const auto [start_real, start_imag, constant_real, constant_imag] = self._orbit_start(num_real, num_imag);
+
+                auto real = std::array<Vector, juliet::formula::MaxRegisters>{};
+                auto imag = std::array<Vector, juliet::formula::MaxRegisters>{};
+
+                self.formula.load(real, imag, start_real, start_imag, constant_real, constant_imag);
+
+                /* NOTE: As in 'impl::continue_lanes', bounded lanes have all their bits set, and so subtracting them counts up. */
+                auto bounded    = ~Mask{};
+                auto iterations = Mask{};
+
+                for (const auto _ : std::views::iota(0uz, MaxIterations)) {
+                    self.formula.evaluate(real, imag);
+
+                    const auto value_real = real[juliet::formula::ValueRegister];
+                    const auto value_imag = imag[juliet::formula::ValueRegister];
+
+                    bounded &= (value_real * value_real + value_imag * value_imag <= escape_magnitude_sq);
+
+                    if (!simd::any(bounded)) {
+                        break;
+                    }
+
+                    iterations -= bounded;
+                }
+
+                return simd::store<std::size_t>(iterations);
+            });
+        }
+    };
+
+    using formula_set = juliet::basic_formula_set<>;
+
+    static_assert(juliet::iterative_set<juliet::formula_set>);
+    static_assert(juliet::rescalable_set<juliet::formula_set>);
+
+    namespace test {
+
+        static_assert(juliet::formula::parse("z^2 + c").has_value());
+        static_assert(juliet::formula::parse("(z*z - 0.5i) / (1.5 + conj(z)) + re(c)").has_value());
+
+        static_assert(juliet::formula::parse("z^2 +").error().position == 5);
+        static_assert(juliet::formula::parse("z^2 + foo(z)").error().position == 6);
+        static_assert(juliet::formula::parse("z^0 + c").error().position == 2);
+        static_assert(juliet::formula::parse("z c").error().position == 2);
+
+        static_assert([]() {
+            const auto nested = [](const std::size_t depth) {
+                return std::string(depth, '(') + "z" + std::string(depth, ')');
+            };
+
+            const auto deepest = juliet::formula::parse(nested(juliet::impl::formula_parser::MaxDepth - 1));
+            const auto too_deep = juliet::formula::parse(nested(1'000));
+
+            return (
+                deepest.has_value() &&
+
+                !too_deep.has_value() &&
+                too_deep.error().message == "too deeply nested" &&
+
+                juliet::formula::parse(std::string(1'000, '-') + "z").error().message == "too deeply nested"
+            );
+        }());
+
+        /* NOTE: 'z^5' is the square of a square times the original. */
+        static_assert(juliet::formula::parse("z^5").value().instructions.size() == 3);
+
+        template<std::size_t MaxIterations>
+        consteval bool formula_matches(const std::string_view source, const juliet::iterative_set auto &set, const std::optional<juliet::complex> julia_constant = std::nullopt) {
+            return test::iterates_like<MaxIterations>(juliet::formula_set{juliet::formula::parse(source).value(), julia_constant}, set);
+        }
+
+        static_assert(formula_matches<100>("z^2 + c",                  test::unchecked_mandelbrot_set{}));
+        static_assert(formula_matches<100>("c + z^2",                  test::unchecked_mandelbrot_set{}));
+        static_assert(formula_matches<100>("abs_components(z)^2 + c",  juliet::burning_ship_set));
+        static_assert(formula_matches<100>("conj(z)^2 + c",            juliet::tricorn_set));
+
+        static_assert(formula_matches<100>("z^2 + c", juliet::quadratic_julia_set{{-0.8_scalar, 0.156_scalar}}, juliet::complex{-0.8_scalar, 0.156_scalar}));
+
+    }
+
+}
@@ -4,14 +4,25 @@
 #include <cstdint>
 #include <cmath>
 #include <cstdio>
+#include <cstdlib>
 
 #include <stdfloat>
 #include <bit>
+#include <limits>
+#include <compare>
 #include <numeric>
 #include <numbers>
 #include <utility>
 #include <functional>
+#include <string>
 #include <string_view>
+#include <optional>
+#include <variant>
+#include <expected>
+#include <array>
+#include <span>
+#include <vector>
+#include <memory>
 #include <complex>
 #include <ranges>
 #include <algorithm>
@@ -20,6 +31,7 @@
 #include <thread>
 #include <mutex>
 #include <condition_variable>
+#include <atomic>
 #include <chrono>
 
 #include <BS_thread_pool.hpp>
@@ -0,0 +1,373 @@
+#pragma once
+
+#include <juliet/common.hpp>
+#include <juliet/color.hpp>
+#include <juliet/sets.hpp>
+#include <juliet/render.hpp>
+
+#include <fpng.h>
+
+namespace juliet {
+
+    /* Whether each pixel of a resolution has been visited, one bit per pixel. */
+    struct pixel_bitmap {
+        juliet::resolution resolution;
+
+        std::vector<std::uint64_t> words;
+
+        constexpr explicit pixel_bitmap(const juliet::resolution resolution)
+        :
+            resolution(resolution),
+            words((static_cast<std::size_t>(resolution.area()) + 63) / 64, 0)
+        {}
+
+        constexpr std::size_t _index_of(this const pixel_bitmap &self, const juliet::coords coords) {
+            return static_cast<std::size_t>(coords.y * self.resolution.width() + coords.x);
+        }
+
+        constexpr bool test(this const pixel_bitmap &self, const juliet::coords coords) {
+            const auto index = self._index_of(coords);
+
+            return ((self.words[index / 64] >> (index % 64)) & 1) != 0;
+        }
+
+        /* Sets the pixel, returning whether it had already been set. */
+        constexpr bool test_and_set(this pixel_bitmap &self, const juliet::coords coords) {
+            const auto index = self._index_of(coords);
+            const auto bit   = std::uint64_t{1} << (index % 64);
+
+            auto &word = self.words[index / 64];
+
+            const auto was_set = (word & bit) != 0;
+            word |= bit;
+
+            return was_set;
+        }
+
+        /*
+            Like 'test_and_set', but safe to call from several
+            threads at once, so that they can all share the bitmap.
+
+            NOTE: Most pixels we're handed have already been set, so
+            we first check without writing, which keeps the threads
+            from fighting over words which won't change.
+        */
+        bool shared_test_and_set(this pixel_bitmap &self, const juliet::coords coords) {
+            const auto index = self._index_of(coords);
+            const auto bit   = std::uint64_t{1} << (index % 64);
+
+            const auto word = std::atomic_ref<std::uint64_t>(self.words[index / 64]);
+
+            if ((word.load(std::memory_order_relaxed) & bit) != 0) {
+                return true;
+            }
+
+            return (word.fetch_or(bit, std::memory_order_relaxed) & bit) != 0;
+        }
+
+        constexpr void clear(this pixel_bitmap &self) {
+            std::ranges::fill(self.words, 0);
+        }
+    };
+
+    namespace impl {
+
+        /* NOTE: Like 'std::sqrt' for complex numbers, taking the principal root, but usable at compile time. */
+        constexpr juliet::complex principal_sqrt(const juliet::complex &num) {
+            if (num.real() == 0.0_scalar && num.imag() == 0.0_scalar) {
+                return {};
+            }
+
+            /* NOTE: We find the larger part first and divide for the other, so that neither loses its precision to cancellation. */
+            const auto magnitude = std::sqrt(juliet::magnitude_sq(num));
+            const auto larger    = std::sqrt((magnitude + std::abs(num.real())) / 2.0_scalar);
+            const auto smaller   = std::abs(num.imag()) / (2.0_scalar * larger);
+
+            if (num.real() >= 0.0_scalar) {
+                return {larger, std::copysign(smaller, num.imag())};
+            }
+
+            return {smaller, std::copysign(larger, num.imag())};
+        }
+
+        /* The two numbers which 'z^2 + constant' maps to the number. */
+        constexpr std::array<juliet::complex, 2> inverse_images(const juliet::complex &num, const juliet::complex &constant) {
+            const auto root = impl::principal_sqrt(num - constant);
+
+            return {root, -root};
+        }
+
+    }
+
+    /*
+        Draws the boundary of a quadratic Julia set by the modified
+        inverse iteration method, following the preimages of a point
+        on the boundary back through the set, instead of iterating
+        every pixel forwards.
+
+        Preimages spread out over the whole boundary, and so each
+        branch of preimages is pruned as soon as it lands on a pixel
+        which has already been drawn. This takes time in proportion
+        to the pixels of the boundary rather than to the whole image.
+
+        NOTE: Preimages which land off the screen are instead pruned
+        by a coarse overview of the whole set, so that zoomed-in
+        frames still finish. Parts of the boundary which are only
+        reached through densely-visited parts of the overview may
+        then go missing, as is usual for this method.
+    */
+    struct julia_boundary_renderer {
+        juliet::resolution _resolution;
+        juliet::frame      _frame;
+
+        juliet::pixel_bitmap _boundary;
+
+        /* NOTE: The overview covers every number the set could have, at this resolution across. */
+        juliet::coord overview_length = 1024;
+
+        color::rgb boundary_color   = color::rgb::gray(255);
+        color::rgb background_color = color::rgb::gray(0);
+
+        constexpr julia_boundary_renderer(const juliet::resolution resolution, const juliet::frame &frame)
+        :
+            _resolution(resolution),
+            _frame(frame),
+            _boundary(resolution)
+        {}
+
+        constexpr juliet::resolution resolution(this const julia_boundary_renderer &self) {
+            return self._resolution;
+        }
+
+        constexpr juliet::frame frame(this const julia_boundary_renderer &self) {
+            return self._frame;
+        }
+
+        constexpr auto &boundary(this auto &self) {
+            return self._boundary;
+        }
+
+        constexpr juliet::resolution overview_resolution(this const julia_boundary_renderer &self) {
+            return {self.overview_length, self.overview_length};
+        }
+
+        /* NOTE: Every number of the set is within the larger of 2 and the magnitude of the constant. */
+        constexpr juliet::frame overview_frame(this const julia_boundary_renderer &self, const juliet::complex &constant) {
+            const auto radius = std::max(2.0_scalar, std::sqrt(juliet::magnitude_sq(constant)));
+
+            return {{}, 2.0_scalar * radius / static_cast<juliet::scalar>(self.overview_length)};
+        }
+
+        /*
+            Returns points on the boundary to start tracing from, at
+            least 'min_count' of them unless the set has fewer pixels,
+            drawing them and everything they were found from.
+
+            NOTE: These are the preimages of the repelling fixed point,
+            all of which lie on the boundary, found breadth-first so
+            that they can be traced from independently of each other.
+        */
+        template<typename Periodicity, typename Scalar>
+        constexpr std::vector<juliet::complex> starting_points(
+            this julia_boundary_renderer &self,
+            const juliet::basic_quadratic_julia_set<Periodicity, Scalar> &set,
+            const std::size_t min_count
+        ) {
+            /* NOTE: Past this depth the preimages stop being spread out any further. */
+            static constexpr auto MaxDepth = 24uz;
+
+            const auto constant = juliet::complex_cast<juliet::scalar>(set.constant);
+
+            /* NOTE: With the principal square root, this is always the fixed point which is repelling. */
+            auto points = std::vector<juliet::complex>{
+                (1.0_scalar + impl::principal_sqrt(1.0_scalar - 4.0_scalar * constant)) / 2.0_scalar
+            };
+
+            for (const auto _ : std::views::iota(0uz, MaxDepth)) {
+                if (points.size() >= min_count) {
+                    break;
+                }
+
+                auto next_points = std::vector<juliet::complex>{};
+                next_points.reserve(2 * points.size());
+
+                for (const auto &point : points) {
+                    const auto coords = self._frame.screen_coords_at_number(self._resolution, point);
+                    if (coords.has_value()) {
+                        self._boundary.test_and_set(*coords);
+                    }
+
+                    std::ranges::copy(impl::inverse_images(point, constant), std::back_inserter(next_points));
+                }
+
+                points = std::move(next_points);
+            }
+
+            return points;
+        }
+
+        /*
+            Traces the boundary back from each of the points into
+            'boundary', using 'overview' for those off the screen.
+
+            NOTE: Several threads may trace into the same bitmaps at
+            once, and each prunes against what the others have drawn,
+            so that between them they only trace the boundary once.
+        */
+        template<typename Periodicity, typename Scalar>
+        void trace_boundary(
+            this const julia_boundary_renderer &self,
+            const juliet::basic_quadratic_julia_set<Periodicity, Scalar> &set,
+            const std::span<const juliet::complex> points,
+
+            juliet::pixel_bitmap &boundary,
+            juliet::pixel_bitmap &overview
+        ) {
+            const auto constant = juliet::complex_cast<juliet::scalar>(set.constant);
+
+            const auto overview_frame      = self.overview_frame(constant);
+            const auto overview_resolution = self.overview_resolution();
+
+            /* NOTE: Depth-first, so that the stack only grows with how far back we've followed a branch. */
+            auto stack = std::vector<juliet::complex>(points.begin(), points.end());
+
+            while (!stack.empty()) {
+                const auto point = stack.back();
+                stack.pop_back();
+
+                const auto coords = self._frame.screen_coords_at_number(self._resolution, point);
+                if (coords.has_value()) {
+                    if (boundary.shared_test_and_set(*coords)) {
+                        continue;
+                    }
+                } else {
+                    const auto overview_coords = overview_frame.screen_coords_at_number(overview_resolution, point);
+
+                    if (!overview_coords.has_value() || overview.shared_test_and_set(*overview_coords)) {
+                        continue;
+                    }
+                }
+
+                std::ranges::copy(impl::inverse_images(point, constant), std::back_inserter(stack));
+            }
+        }
+
+        template<typename Periodicity, typename Scalar>
+        void render_julia_boundary(this julia_boundary_renderer &self, const juliet::basic_quadratic_julia_set<Periodicity, Scalar> &set) {
+            self._boundary.clear();
+
+            const auto points = self.starting_points(set, 1);
+
+            auto overview = juliet::pixel_bitmap(self.overview_resolution());
+
+            self.trace_boundary(set, points, self._boundary, overview);
+        }
+
+        std::vector<color::rgb> pixels(this const julia_boundary_renderer &self) {
+            auto pixels = std::vector<color::rgb>(static_cast<std::size_t>(self._resolution.area()));
+
+            for (const auto coords : self._resolution.screen_coords()) {
+                pixels[self._boundary._index_of(coords)] = self._boundary.test(coords) ? self.boundary_color : self.background_color;
+            }
+
+            return pixels;
+        }
+
+        void save_png(this const julia_boundary_renderer &self, const char *path) {
+            const auto pixels = self.pixels();
+
+            /* NOTE: It's okay to call this multiple times. */
+            fpng::fpng_init();
+
+            fpng::fpng_encode_image_to_file(
+                path,
+                pixels.data(),
+
+                static_cast<std::uint32_t>(self._resolution.width()),
+                static_cast<std::uint32_t>(self._resolution.height()),
+
+                3
+            );
+        }
+    };
+
+
+    namespace test {
+
+        static_assert([]() {
+            /* NOTE: Two words, so that the last row lands in the second one. */
+            auto bitmap = juliet::pixel_bitmap({16, 5});
+
+            if (bitmap.words.size() != 2) {
+                return false;
+            }
+
+            if (bitmap.test_and_set({3, 1}) || !bitmap.test_and_set({3, 1})) {
+                return false;
+            }
+
+            return bitmap.test({3, 1}) && !bitmap.test({4, 1}) && !bitmap.test({3, 2});
+        }());
+
+        static_assert([]() {
+            auto bitmap = juliet::pixel_bitmap({16, 5});
+
+            bitmap.test_and_set({1, 0});
+            bitmap.test_and_set({2, 4});
+
+            if (bitmap.words[0] == 0 || bitmap.words[1] == 0) {
+                return false;
+            }
+
+            bitmap.clear();
+
+            return bitmap.words == std::vector<std::uint64_t>{0, 0};
+        }());
+
+        consteval bool inverse_images_map_back(const juliet::complex &num, const juliet::complex &constant) {
+            for (const auto &image : impl::inverse_images(num, constant)) {
+                if (juliet::magnitude_sq(image * image + constant - num) > 1e-24_scalar) {
+                    return false;
+                }
+            }
+
+            return true;
+        }
+
+        static_assert(inverse_images_map_back({0.3_scalar, -0.7_scalar}, {-0.8_scalar, 0.156_scalar}));
+        static_assert(inverse_images_map_back({-1.5_scalar, 0.2_scalar}, {0.285_scalar, 0.01_scalar}));
+        static_assert(inverse_images_map_back({-1.0_scalar, 0.0_scalar}, {}));
+
+        /* NOTE: The two images are each other's negatives, so they land in opposite half-planes. */
+        static_assert(impl::inverse_images({-1.0_scalar, 0.0_scalar}, {}) == std::array{juliet::complex{0.0_scalar, 1.0_scalar}, juliet::complex{-0.0_scalar, -1.0_scalar}});
+
+        consteval bool starts_on_repelling_fixed_point(const juliet::quadratic_julia_set &set) {
+            auto renderer = juliet::julia_boundary_renderer({64, 64}, juliet::frame::complete({64, 64}));
+
+            const auto points = renderer.starting_points(set, 1);
+            if (points.size() != 1) {
+                return false;
+            }
+
+            const auto point = points.front();
+
+            const auto is_fixed     = juliet::magnitude_sq(point * point + set.constant - point) <= 1e-24_scalar;
+            const auto is_repelling = juliet::magnitude_sq(2.0_scalar * point) > 1.0_scalar;
+
+            return is_fixed && is_repelling;
+        }
+
+        static_assert(starts_on_repelling_fixed_point(juliet::quadratic_julia_set{{-0.8_scalar, 0.156_scalar}}));
+        static_assert(starts_on_repelling_fixed_point(juliet::quadratic_julia_set{{0.285_scalar, 0.01_scalar}}));
+        static_assert(starts_on_repelling_fixed_point(juliet::quadratic_julia_set{{-1.0_scalar, 0.0_scalar}}));
+
+        /* NOTE: For the unit circle, 0 is the attracting fixed point and 1 the repelling one. */
+        static_assert([]() {
+            auto renderer = juliet::julia_boundary_renderer({64, 64}, juliet::frame::complete({64, 64}));
+
+            return renderer.starting_points(juliet::quadratic_julia_set{}, 1) == std::vector{juliet::complex{1.0_scalar, 0.0_scalar}};
+        }());
+
+    }
+
+}
@@ -2,10 +2,24 @@
 
 #include <juliet/common.hpp>
 
+#include <juliet/simd.hpp>
 #include <juliet/color.hpp>
+#include <juliet/floatexp.hpp>
+#include <juliet/multi_double.hpp>
+#include <juliet/fixed_point.hpp>
+#include <juliet/bigfixed.hpp>
 #include <juliet/sets.hpp>
+#include <juliet/newton.hpp>
+#include <juliet/formula.hpp>
+#include <juliet/compiled_formula.hpp>
+#include <juliet/lyapunov.hpp>
+#include <juliet/perturbation.hpp>
 #include <juliet/render.hpp>
 #include <juliet/ascii_renderer.hpp>
 #include <juliet/rgb_renderer.hpp>
+#include <juliet/exponent_map.hpp>
+#include <juliet/orbit_density.hpp>
+#include <juliet/julia_boundary.hpp>
+#include <juliet/reduction.hpp>
 #include <juliet/renderer_thread_pool.hpp>
 #include <juliet/viewer.hpp>
@@ -0,0 +1,280 @@
+#pragma once
+
+#include <juliet/common.hpp>
+#include <juliet/simd.hpp>
+#include <juliet/sets.hpp>
+#include <juliet/floatexp.hpp>
+
+namespace juliet {
+
+    namespace impl {
+
+        /*
+            The Lyapunov exponent of the logistic map 'x -> r x (1 - x)',
+            with its rate alternating between 'a' and 'b' as the pattern
+            says, for plain scalars or for each lane of vectors.
+
+            NOTE: Every lane follows the same pattern, so choosing the
+            rate is a plain branch rather than anything per lane.
+        */
+        template<std::size_t NumTerms, typename Value>
+        [[gnu::always_inline]]
+        constexpr Value lyapunov_exponent(
+            const Value &a,
+            const Value &b,
+
+            const std::uint64_t pattern,
+            const std::size_t   pattern_length,
+
+            const std::size_t    warmup_iterations,
+            const juliet::scalar initial_value
+        ) {
+            const auto one = simd::broadcast<Value>(1.0_scalar);
+
+            auto value    = simd::broadcast<Value>(initial_value);
+            auto position = 0uz;
+
+            const auto next_rate = [&]() -> const Value & {
+                const auto &rate = (((pattern >> position) & 1) != 0) ? b : a;
+
+                ++position;
+                if (position == pattern_length) {
+                    position = 0;
+                }
+
+                return rate;
+            };
+
+            for (const auto _ : std::views::iota(0uz, warmup_iterations)) {
+                const auto &rate = next_rate();
+
+                value = rate * value * (one - value);
+            }
+
+            /*
+                NOTE: Summing in base 2 with our fast logarithm saves a
+                call to 'std::log' for every term, and we only convert
+                to the natural logarithm once at the end.
+            */
+            auto sum = Value{};
+            for (const auto _ : std::views::iota(0uz, NumTerms)) {
+                const auto &rate = next_rate();
+
+                const auto derivative = rate * (one - (value + value));
+
+                sum += simd::fast_log2(simd::abs(derivative));
+
+                value = rate * value * (one - value);
+            }
+
+            return sum * simd::broadcast<Value>(std::numbers::ln2_v<juliet::scalar> / static_cast<juliet::scalar>(NumTerms));
+        }
+
+    }
+
+    /*
+        A Markus-Lyapunov fractal, which colors each point '(a, b)'
+        by how stable the logistic map is when its rate alternates
+        between 'a' and 'b' following a sequence like "AB".
+
+        The real part of each number is used as 'a' and the
+        imaginary part as 'b', and so the interesting parts
+        are in the square from '2 + 2i' to '4 + 4i'.
+
+        NOTE: Negative exponents are where the map settles down,
+        and positive ones where it's chaotic. Superstable maps, whose
+        derivative reaches zero, give '-inf', and maps which blow up
+        give NaN. Only builtin floating-point scalars are supported,
+        as our fast logarithm reads their bits.
+    */
+    template<std::floating_point Scalar = juliet::scalar>
+    struct basic_lyapunov_fractal {
+        using scalar = Scalar;
+
+        static constexpr std::size_t MaxSequenceLength = 64;
+
+        /* NOTE: The bit for each step of the sequence is set when it uses 'b'. */
+        std::uint64_t pattern;
+        std::size_t   pattern_length;
+
+        /* NOTE: The iterations which are thrown away so the map can settle before its exponent is measured. */
+        std::size_t warmup_iterations = 100;
+
+        juliet::scalar initial_value = 0.5_scalar;
+
+        /* NOTE: Returns nothing unless the sequence is made of only 'A' and 'B', and isn't empty or too long. */
+        static constexpr std::optional<basic_lyapunov_fractal> from_sequence(const std::string_view sequence) {
+            if (sequence.empty() || sequence.size() > MaxSequenceLength) {
+                return std::nullopt;
+            }
+
+            auto pattern = std::uint64_t{0};
+            for (const auto i : std::views::iota(0uz, sequence.size())) {
+                if (sequence[i] == 'B') {
+                    pattern |= std::uint64_t{1} << i;
+                } else if (sequence[i] != 'A') {
+                    return std::nullopt;
+                }
+            }
+
+            return basic_lyapunov_fractal{pattern, sequence.size()};
+        }
+
+        template<std::floating_point OtherScalar>
+        constexpr basic_lyapunov_fractal<OtherScalar> with_scalar(this const basic_lyapunov_fractal &self) {
+            return {self.pattern, self.pattern_length, self.warmup_iterations, self.initial_value};
+        }
+
+        /* NOTE: Fractals made without 'from_sequence' could have patterns which don't fit, which we'd otherwise shift past. */
+        constexpr bool has_valid_pattern(this const basic_lyapunov_fractal &self) {
+            return self.pattern_length > 0 && self.pattern_length <= MaxSequenceLength;
+        }
+
+        /*
+            NOTE: How many terms we average over is chosen like max iterations,
+            so renderers can pick it the same way. Fractals without a valid
+            pattern have no exponents, and so give NaN.
+        */
+        template<std::size_t NumTerms>
+        constexpr std::float32_t exponent(this const basic_lyapunov_fractal &self, const juliet::complex_for<Scalar> &num) {
+            if (!self.has_valid_pattern()) {
+                return std::numeric_limits<std::float32_t>::quiet_NaN();
+            }
+
+            return static_cast<std::float32_t>(impl::lyapunov_exponent<NumTerms>(
+                num.real(),
+                num.imag(),
+
+                self.pattern,
+                self.pattern_length,
+
+                self.warmup_iterations,
+                self.initial_value
+            ));
+        }
+
+        template<std::size_t NumTerms, std::size_t Width>
+        requires (std::has_single_bit(Width) && simd::vectorizable<Scalar>)
+        constexpr std::array<std::float32_t, Width> exponent(this const basic_lyapunov_fractal &self, const juliet::complex_batch<Width, Scalar> &nums) {
+            if (!self.has_valid_pattern()) {
+                auto exponents = std::array<std::float32_t, Width>{};
+                exponents.fill(std::numeric_limits<std::float32_t>::quiet_NaN());
+
+                return exponents;
+            }
+
+            return impl::iterate_batch(nums, [&self]<typename Vector>(const Vector &real, const Vector &imag) {
+                return simd::store<std::float32_t>(impl::lyapunov_exponent<NumTerms>(
+                    real,
+                    imag,
+
+                    self.pattern,
+                    self.pattern_length,
+
+                    self.warmup_iterations,
+                    self.initial_value
+                ));
+            });
+        }
+    };
+
+    using lyapunov_fractal = juliet::basic_lyapunov_fractal<>;
+
+    template<typename Fractal>
+    concept lyapunov_fractal_like = requires(const Fractal &fractal, const juliet::complex_for<juliet::set_scalar<Fractal>> num) {
+        { fractal.template exponent<1uz>(num) } -> std::same_as<std::float32_t>;
+    };
+
+    template<std::size_t NumTerms, std::size_t Width, typename Scalar>
+    constexpr std::array<std::float32_t, Width> batch_exponents(const juliet::lyapunov_fractal_like auto &fractal, const juliet::complex_batch<Width, Scalar> &nums) {
+        if constexpr (requires { { fractal.template exponent<NumTerms>(nums) } -> std::same_as<std::array<std::float32_t, Width>>; }) {
+            return fractal.template exponent<NumTerms>(nums);
+        } else {
+            auto exponents = std::array<std::float32_t, Width>{};
+
+            for (const auto i : std::views::iota(0uz, Width)) {
+                exponents[i] = fractal.template exponent<NumTerms>(nums[i]);
+            }
+
+            return exponents;
+        }
+    }
+
+    static_assert(juliet::lyapunov_fractal_like<juliet::lyapunov_fractal>);
+    static_assert(juliet::lyapunov_fractal_like<juliet::basic_lyapunov_fractal<std::float32_t>>);
+
+    namespace test {
+
+        static_assert(simd::fast_log2(8.0_scalar) == 3.0_scalar);
+        static_assert(simd::fast_log2(0.25f32) == -2.0f32);
+
+        static_assert(std::abs(simd::fast_log2(10.0_scalar) - 3.321928094887362_scalar) < 1e-7_scalar);
+        static_assert(std::abs(simd::fast_log2(0.7_scalar) + 0.514573172829758_scalar) < 1e-7_scalar);
+
+        static_assert(simd::fast_log2(0.0_scalar) == -std::numeric_limits<juliet::scalar>::infinity());
+        static_assert(simd::fast_log2(0.0f32)     == -std::numeric_limits<std::float32_t>::infinity());
+
+        static_assert(std::isnan(simd::fast_log2(std::numeric_limits<juliet::scalar>::infinity())));
+        static_assert(std::isnan(simd::fast_log2(std::numeric_limits<juliet::scalar>::quiet_NaN())));
+        static_assert(std::isnan(simd::fast_log2(std::numeric_limits<std::float32_t>::infinity())));
+
+        static_assert([]() {
+            const auto values = simd::fast_log2(simd::vector<juliet::scalar, 4>{
+                0.0_scalar,
+                std::numeric_limits<juliet::scalar>::infinity(),
+                8.0_scalar,
+                std::numeric_limits<juliet::scalar>::quiet_NaN()
+            });
+
+            return values[0] == -std::numeric_limits<juliet::scalar>::infinity() && std::isnan(values[1]) && values[2] == 3.0_scalar && std::isnan(values[3]);
+        }());
+
+        static_assert(juliet::lyapunov_fractal::from_sequence("AB")->pattern == 0b10);
+        static_assert(juliet::lyapunov_fractal::from_sequence("BBBBBBAAAAAA")->pattern_length == 12);
+        static_assert(!juliet::lyapunov_fractal::from_sequence("").has_value());
+        static_assert(!juliet::lyapunov_fractal::from_sequence("ABC").has_value());
+        static_assert(!juliet::lyapunov_fractal::from_sequence("ABABABABABABABABABABABABABABABABABABABABABABABABABABABABABABABABA").has_value());
+
+        static_assert(std::isnan(juliet::lyapunov_fractal{0b1, 0}.exponent<200>(juliet::complex{3.0_scalar, 3.0_scalar})));
+        static_assert(std::isnan(juliet::lyapunov_fractal{0b1, 65}.exponent<200>(juliet::complex{3.0_scalar, 3.0_scalar})));
+
+        template<typename Scalar>
+        concept lyapunov_scalar = requires { typename juliet::basic_lyapunov_fractal<Scalar>; };
+
+        static_assert(lyapunov_scalar<std::float32_t>);
+        static_assert(!lyapunov_scalar<juliet::double_double>);
+        static_assert(!lyapunov_scalar<juliet::fixed_point>);
+        static_assert(!lyapunov_scalar<juliet::floatexp>);
+
+        /* NOTE: Across where the map is interesting, with rates between 2 and 4. */
+        constexpr inline auto lyapunov_sample_min = juliet::complex{2.0_scalar, 2.0_scalar};
+        constexpr inline auto lyapunov_sample_max = juliet::complex{4.0_scalar, 4.0_scalar};
+
+        template<std::size_t NumTerms>
+        consteval bool exponent_batch_matches_scalar(const juliet::lyapunov_fractal_like auto &fractal) {
+            return test::batch_matches_scalar<juliet::set_scalar<decltype(fractal)>>(
+                [&](const auto &nums) {
+                    return juliet::batch_exponents<NumTerms>(fractal, nums);
+                },
+
+                [&](const auto &num) {
+                    return fractal.template exponent<NumTerms>(num);
+                },
+
+                test::lyapunov_sample_min,
+                test::lyapunov_sample_max
+            );
+        }
+
+        static_assert(exponent_batch_matches_scalar<200>(*juliet::lyapunov_fractal::from_sequence("AB")));
+        static_assert(exponent_batch_matches_scalar<200>(juliet::lyapunov_fractal::from_sequence("AABAB")->with_scalar<std::float32_t>()));
+
+        /* NOTE: With a rate of 2 the map sits on its fixed point of 1/2, where it's superstable and its derivative is zero. */
+        static_assert(juliet::lyapunov_fractal::from_sequence("A")->exponent<200>(juliet::complex{2.0_scalar, 2.0_scalar}) == -std::numeric_limits<std::float32_t>::infinity());
+
+        /* NOTE: With a rate of 3.2 the map settles on a cycle of period 2, and so is stable. */
+        static_assert(juliet::lyapunov_fractal::from_sequence("A")->exponent<200>(juliet::complex{3.2_scalar, 3.2_scalar}) < 0.0f32);
+
+    }
+
+}
@@ -0,0 +1,355 @@
+#pragma once
+
+#include <juliet/common.hpp>
+
+namespace juliet {
+
+    namespace impl {
+
+        struct sum_with_error {
+            std::float64_t sum;
+            std::float64_t error;
+        };
+
+        /* NOTE: See https://www.cs.cmu.edu/~quake-papers/robust-arithmetic.ps for these error-free transformations. */
+
+        [[gnu::always_inline]]
+        constexpr impl::sum_with_error two_sum(const std::float64_t lhs, const std::float64_t rhs) {
+            const auto sum         = lhs + rhs;
+            const auto virtual_rhs = sum - lhs;
+
+            return {sum, (lhs - (sum - virtual_rhs)) + (rhs - virtual_rhs)};
+        }
+
+        /* NOTE: Requires that '|lhs| >= |rhs|', or that 'lhs' is zero. */
+        [[gnu::always_inline]]
+        constexpr impl::sum_with_error quick_two_sum(const std::float64_t lhs, const std::float64_t rhs) {
+            const auto sum = lhs + rhs;
+
+            return {sum, rhs - (sum - lhs)};
+        }
+
+        [[gnu::always_inline]]
+        constexpr impl::sum_with_error two_product(const std::float64_t lhs, const std::float64_t rhs) {
+            const auto product = lhs * rhs;
+
+            if consteval {
+                /* NOTE: Dekker's splitting, since we can't rely on 'std::fma' in constant evaluation. */
+                static constexpr auto Splitter = 134217729.0f64;
+
+                const auto split = [](const std::float64_t value) {
+                    const auto scaled = Splitter * value;
+                    const auto high   = scaled - (scaled - value);
+
+                    return impl::sum_with_error{high, value - high};
+                };
+
+                const auto [lhs_high, lhs_low] = split(lhs);
+                const auto [rhs_high, rhs_low] = split(rhs);
+
+                return {product, ((lhs_high * rhs_high - product) + lhs_high * rhs_low + lhs_low * rhs_high) + lhs_low * rhs_low};
+            } else {
+                return {product, std::fma(lhs, rhs, -product)};
+            }
+        }
+
+        /*
+            An exact sum of doubles, kept as a nonoverlapping
+            list of terms in increasing order of magnitude.
+        */
+        template<std::size_t Capacity>
+        struct expansion {
+            std::array<std::float64_t, Capacity> terms = {};
+            std::size_t size = 0;
+
+            constexpr void add(this expansion &self, const std::float64_t value) {
+                auto carry    = value;
+                auto new_size = 0uz;
+
+                /* NOTE: We only ever write behind where we read, and we drop zero terms as we go. */
+                for (const auto i : std::views::iota(0uz, self.size)) {
+                    const auto [sum, error] = impl::two_sum(carry, self.terms[i]);
+
+                    carry = sum;
+
+                    if (error != 0) {
+                        self.terms[new_size] = error;
+
+                        ++new_size;
+                    }
+                }
+
+                if (carry != 0) {
+                    self.terms[new_size] = carry;
+
+                    ++new_size;
+                }
+
+                self.size = new_size;
+            }
+
+            /* Returns the largest terms after compressing, from largest to smallest. */
+            template<std::size_t N>
+            constexpr std::array<std::float64_t, N> largest_terms(this const expansion &self) {
+                auto result = std::array<std::float64_t, N>{};
+
+                if (self.size == 0) {
+                    return result;
+                }
+
+                /* NOTE: Shewchuk's 'Compress', so that each term is no larger than half an ulp of the one before. */
+                auto gathered = self.terms;
+                auto bottom   = self.size - 1;
+                auto carry    = self.terms[bottom];
+
+                for (const auto i : std::views::iota(0uz, self.size - 1) | std::views::reverse) {
+                    const auto [sum, error] = impl::quick_two_sum(carry, self.terms[i]);
+
+                    if (error != 0) {
+                        gathered[bottom] = sum;
+                        --bottom;
+
+                        carry = error;
+                    } else {
+                        carry = sum;
+                    }
+                }
+
+                gathered[bottom] = carry;
+
+                auto compressed = std::array<std::float64_t, Capacity>{};
+                auto top        = 0uz;
+
+                for (const auto i : std::views::iota(bottom + 1, self.size)) {
+                    const auto [sum, error] = impl::quick_two_sum(gathered[i], carry);
+
+                    if (error != 0) {
+                        compressed[top] = error;
+                        ++top;
+                    }
+
+                    carry = sum;
+                }
+
+                compressed[top] = carry;
+
+                for (const auto i : std::views::iota(0uz, std::min(N, top + 1))) {
+                    result[i] = compressed[top - i];
+                }
+
+                return result;
+            }
+        };
+
+    }
+
+    /*
+        A number held as the unevaluated sum of several
+        doubles, for 'N' times the precision of one but
+        only a small multiple of the cost.
+
+        See https://www.davidhbailey.com/dhbpapers/qd.pdf
+    */
+    template<std::size_t N>
+    requires (N >= 2)
+    struct multi_double {
+        /* NOTE: The number of bits of precision we carry, give or take. */
+        static constexpr std::size_t digits = N * std::numeric_limits<std::float64_t>::digits;
+
+        /* NOTE: Nonoverlapping, from the largest to the smallest. */
+        std::array<std::float64_t, N> components = {};
+
+        constexpr multi_double() = default;
+
+        constexpr multi_double(const std::float64_t value) : components{value} {}
+
+        template<std::integral Integer>
+        constexpr explicit multi_double(const Integer value) {
+            const auto high = static_cast<std::float64_t>(value);
+            const auto low  = static_cast<std::float64_t>(value - static_cast<Integer>(high));
+
+            const auto [sum, error] = impl::quick_two_sum(high, low);
+
+            this->components[0] = sum;
+            this->components[1] = error;
+        }
+
+        template<std::size_t OtherN>
+        requires (OtherN != N)
+        constexpr explicit multi_double(const multi_double<OtherN> &other) {
+            for (const auto i : std::views::iota(0uz, std::min(N, OtherN))) {
+                this->components[i] = other.components[i];
+            }
+        }
+
+        static constexpr multi_double _from_components(const std::array<std::float64_t, N> &components) {
+            auto result = multi_double{};
+
+            result.components = components;
+
+            return result;
+        }
+
+        template<std::floating_point Float>
+        constexpr explicit operator Float(this const multi_double &self) {
+            /* NOTE: Summing the smallest first so that the rounding is right. */
+            auto sum = 0.0f64;
+
+            for (const auto component : self.components | std::views::reverse) {
+                sum += component;
+            }
+
+            return static_cast<Float>(sum);
+        }
+
+        constexpr multi_double operator -(this multi_double self) {
+            for (auto &component : self.components) {
+                component = -component;
+            }
+
+            return self;
+        }
+
+        /* NOTE: Our sign is the sign of our largest component. */
+        friend constexpr multi_double abs(const multi_double &value) {
+            if (value.components[0] < 0.0f64) {
+                return -value;
+            }
+
+            return value;
+        }
+
+        friend constexpr multi_double operator +(const multi_double &lhs, const multi_double &rhs) {
+            if constexpr (N == 2) {
+                auto [high, high_error] = impl::two_sum(lhs.components[0], rhs.components[0]);
+                auto [low,  low_error]  = impl::two_sum(lhs.components[1], rhs.components[1]);
+
+                high_error += low;
+
+                const auto first = impl::quick_two_sum(high, high_error);
+                const auto last  = impl::quick_two_sum(first.sum, first.error + low_error);
+
+                return multi_double::_from_components({last.sum, last.error});
+            } else {
+                auto sum = impl::expansion<2 * N>{};
+
+                for (const auto i : std::views::iota(0uz, N)) {
+                    sum.add(lhs.components[i]);
+                    sum.add(rhs.components[i]);
+                }
+
+                return multi_double::_from_components(sum.template largest_terms<N>());
+            }
+        }
+
+        friend constexpr multi_double operator -(const multi_double &lhs, const multi_double &rhs) {
+            return lhs + -rhs;
+        }
+
+        friend constexpr multi_double operator *(const multi_double &lhs, const multi_double &rhs) {
+            if constexpr (N == 2) {
+                auto [high, error] = impl::two_product(lhs.components[0], rhs.components[0]);
+
+                error += lhs.components[0] * rhs.components[1] + lhs.components[1] * rhs.components[0];
+
+                const auto [sum, sum_error] = impl::quick_two_sum(high, error);
+
+                return multi_double::_from_components({sum, sum_error});
+            } else {
+                /*
+                    NOTE: Products of components past the 'N'th
+                    order are too small to matter, and those of
+                    exactly the 'N'th order don't need their errors.
+                */
+                auto product = impl::expansion<N * (N + 1) + N - 1>{};
+
+                for (const auto i : std::views::iota(0uz, N)) {
+                    for (const auto j : std::views::iota(0uz, N - i)) {
+                        const auto [term, error] = impl::two_product(lhs.components[i], rhs.components[j]);
+
+                        product.add(term);
+                        product.add(error);
+                    }
+
+                    if (i > 0) {
+                        product.add(lhs.components[i] * rhs.components[N - i]);
+                    }
+                }
+
+                return multi_double::_from_components(product.template largest_terms<N>());
+            }
+        }
+
+        friend constexpr multi_double operator /(const multi_double &lhs, const multi_double &rhs) {
+            /* NOTE: Long division, one component of the quotient at a time. */
+            auto quotient  = impl::expansion<N + 1>{};
+            auto remainder = lhs;
+
+            for (const auto _ : std::views::iota(0uz, N + 1)) {
+                const auto digit = remainder.components[0] / rhs.components[0];
+
+                quotient.add(digit);
+                remainder = remainder - rhs * multi_double(digit);
+            }
+
+            return multi_double::_from_components(quotient.template largest_terms<N>());
+        }
+
+        constexpr multi_double &operator +=(this multi_double &self, const multi_double &rhs) {
+            return self = self + rhs;
+        }
+
+        constexpr multi_double &operator -=(this multi_double &self, const multi_double &rhs) {
+            return self = self - rhs;
+        }
+
+        constexpr multi_double &operator *=(this multi_double &self, const multi_double &rhs) {
+            return self = self * rhs;
+        }
+
+        constexpr multi_double &operator /=(this multi_double &self, const multi_double &rhs) {
+            return self = self / rhs;
+        }
+
+        /* NOTE: Our components are normalized, so we can just compare them in order. */
+        friend constexpr bool operator ==(const multi_double &lhs, const multi_double &rhs) = default;
+
+        friend constexpr std::partial_ordering operator <=>(const multi_double &lhs, const multi_double &rhs) {
+            for (const auto i : std::views::iota(0uz, N)) {
+                if (lhs.components[i] != rhs.components[i]) {
+                    return lhs.components[i] <=> rhs.components[i];
+                }
+            }
+
+            return std::partial_ordering::equivalent;
+        }
+    };
+
+    using double_double = juliet::multi_double<2>;
+    using quad_double   = juliet::multi_double<4>;
+
+    namespace test {
+
+        template<typename MultiDouble>
+        consteval bool keeps_tiny_addends() {
+            const auto tiny = 0x1p-80f64;
+
+            return (MultiDouble(1.0f64) + MultiDouble(tiny)) - MultiDouble(1.0f64) == MultiDouble(tiny);
+        }
+
+        static_assert(keeps_tiny_addends<juliet::double_double>());
+        static_assert(keeps_tiny_addends<juliet::quad_double>());
+
+        static_assert(juliet::double_double(3.0f64) * juliet::double_double(0.5f64) == juliet::double_double(1.5f64));
+        static_assert(juliet::quad_double(3.0f64) * juliet::quad_double(0.5f64) == juliet::quad_double(1.5f64));
+
+        /* Past where a double can tell the difference. */
+        static_assert(juliet::double_double(1.0f64) / juliet::double_double(3.0f64) * juliet::double_double(3.0f64) - juliet::double_double(1.0f64) < juliet::double_double(0x1p-100f64));
+        static_assert(juliet::quad_double(1.0f64) / juliet::quad_double(3.0f64) * juliet::quad_double(3.0f64) - juliet::quad_double(1.0f64) < juliet::quad_double(0x1p-200f64));
+
+        static_assert(juliet::double_double(-2.0f64) < juliet::double_double(1.0f64));
+        static_assert(static_cast<std::float64_t>(juliet::double_double(0.375f64)) == 0.375f64);
+
+    }
+
+}
@@ -0,0 +1,539 @@
+#pragma once
+
+#include <juliet/common.hpp>
+#include <juliet/simd.hpp>
+#include <juliet/sets.hpp>
+
+namespace juliet {
+
+    /*
+        A monic polynomial of a degree known at compile time,
+        which keeps both its roots and its coefficients.
+    */
+    template<std::size_t Degree>
+    requires (Degree >= 2)
+    struct polynomial {
+        std::array<juliet::complex, Degree> roots;
+
+        /* NOTE: From the constant term up, leaving out the leading coefficient, which is always one. */
+        std::array<juliet::complex, Degree> coefficients;
+
+        static constexpr polynomial from_roots(const std::array<juliet::complex, Degree> &roots) {
+            /* NOTE: We multiply in each '(z - root)' in turn, with 'expanded' having its leading coefficient last. */
+            auto expanded = std::array<juliet::complex, Degree + 1>{};
+            expanded[0] = 1.0_scalar;
+
+            for (const auto num_multiplied : std::views::iota(0uz, Degree)) {
+                const auto new_degree = num_multiplied + 1;
+
+                for (const auto i : std::views::iota(0uz, new_degree + 1) | std::views::reverse) {
+                    const auto shifted = (i > 0) ? expanded[i - 1] : juliet::complex{};
+                    const auto kept    = (i < new_degree) ? expanded[i] : juliet::complex{};
+
+                    expanded[i] = shifted - roots[num_multiplied] * kept;
+                }
+            }
+
+            auto result = polynomial{roots, {}};
+            for (const auto i : std::views::iota(0uz, Degree)) {
+                result.coefficients[i] = expanded[i];
+            }
+
+            return result;
+        }
+
+        /* The polynomial 'z^Degree - 1'. */
+        static constexpr polynomial roots_of_unity() {
+            auto roots = std::array<juliet::complex, Degree>{};
+
+            for (const auto i : std::views::iota(0uz, Degree)) {
+                const auto angle = 2.0_scalar * std::numbers::pi_v<juliet::scalar> * static_cast<juliet::scalar>(i) / static_cast<juliet::scalar>(Degree);
+
+                roots[i] = {std::cos(angle), std::sin(angle)};
+            }
+
+            return polynomial::from_roots(roots);
+        }
+
+        constexpr juliet::complex operator ()(this const polynomial &self, const juliet::complex &num) {
+            auto value = juliet::complex{1.0_scalar};
+
+            for (const auto coefficient : self.coefficients | std::views::reverse) {
+                value = value * num + coefficient;
+            }
+
+            return value;
+        }
+    };
+
+    /* How a number converged, for sets which converge instead of escaping. */
+    struct convergence_result {
+        static constexpr std::size_t no_root = std::numeric_limits<std::size_t>::max();
+
+        std::size_t iterations;
+
+        /* NOTE: The index of the root the number converged to, or 'no_root' if it didn't converge to one of them. */
+        std::size_t root;
+
+        friend constexpr bool operator ==(const convergence_result &lhs, const convergence_result &rhs) = default;
+    };
+
+    template<std::size_t Width>
+    using convergences_batch = std::array<juliet::convergence_result, Width>;
+
+    /*
+        Sets which tell how numbers converge instead of how they escape.
+
+        NOTE: They are still iterative sets, with their numbers'
+        iterations being how long they took to converge, so that
+        they can be rendered by any renderer.
+    */
+    template<typename Set>
+    concept convergent_set = juliet::iterative_set<Set> && requires(const Set &set, const juliet::complex_for<juliet::set_scalar<Set>> num) {
+        { set.template iterations_before_convergence<0uz>(num) } -> std::same_as<juliet::convergence_result>;
+    };
+
+    template<std::size_t MaxIterations, std::size_t Width, typename Scalar>
+    constexpr juliet::convergences_batch<Width> batch_iterations_before_convergence(const juliet::convergent_set auto &set, const juliet::complex_batch<Width, Scalar> &nums) {
+        if constexpr (requires { { set.template iterations_before_convergence<MaxIterations>(nums) } -> std::same_as<juliet::convergences_batch<Width>>; }) {
+            return set.template iterations_before_convergence<MaxIterations>(nums);
+        } else {
+            auto convergences = juliet::convergences_batch<Width>{};
+
+            for (const auto i : std::views::iota(0uz, Width)) {
+                convergences[i] = set.template iterations_before_convergence<MaxIterations>(nums[i]);
+            }
+
+            return convergences;
+        }
+    }
+
+    namespace impl {
+
+        /*
+            A polynomial with its coefficients splatted across the
+            lanes of 'Value', or cast to it if it's a plain scalar,
+            along with the other constants of a Newton iteration.
+        */
+        template<std::size_t Degree, typename Value>
+        struct newton_lanes {
+            std::array<Value, Degree> coefficients_real;
+            std::array<Value, Degree> coefficients_imag;
+
+            std::array<Value, Degree> roots_real;
+            std::array<Value, Degree> roots_imag;
+
+            Value relaxation_real;
+            Value relaxation_imag;
+
+            Value tolerance_sq;
+
+            [[gnu::always_inline]]
+            constexpr newton_lanes(const juliet::polynomial<Degree> &polynomial, const juliet::complex &relaxation, const juliet::scalar tolerance)
+            :
+                relaxation_real(simd::broadcast<Value>(relaxation.real())),
+                relaxation_imag(simd::broadcast<Value>(relaxation.imag())),
+
+                tolerance_sq(simd::broadcast<Value>(tolerance * tolerance))
+            {
+                for (const auto i : std::views::iota(0uz, Degree)) {
+                    this->coefficients_real[i] = simd::broadcast<Value>(polynomial.coefficients[i].real());
+                    this->coefficients_imag[i] = simd::broadcast<Value>(polynomial.coefficients[i].imag());
+
+                    this->roots_real[i] = simd::broadcast<Value>(polynomial.roots[i].real());
+                    this->roots_imag[i] = simd::broadcast<Value>(polynomial.roots[i].imag());
+                }
+            }
+
+            /* Moves the number by the relaxed Newton step of the polynomial, then by the constant. */
+            [[gnu::always_inline]]
+            constexpr void step(
+                this const newton_lanes &self,
+
+                Value &real,
+                Value &imag,
+
+                const Value &constant_real,
+                const Value &constant_imag
+            ) {
+                /*
+                    NOTE: Horner's method, evaluating the polynomial and
+                    its derivative together. The leading coefficient is
+                    one, so we start from having already taken it in.
+                */
+                auto value_real = real + self.coefficients_real[Degree - 1];
+                auto value_imag = imag + self.coefficients_imag[Degree - 1];
+
+                auto derivative_real = simd::broadcast<Value>(1.0_scalar);
+                auto derivative_imag = Value{};
+
+                for (const auto i : std::views::iota(0uz, Degree - 1) | std::views::reverse) {
+                    const auto new_derivative_real = derivative_real * real - derivative_imag * imag + value_real;
+                    const auto new_derivative_imag = derivative_real * imag + derivative_imag * real + value_imag;
+
+                    const auto new_value_real = value_real * real - value_imag * imag + self.coefficients_real[i];
+                    const auto new_value_imag = value_real * imag + value_imag * real + self.coefficients_imag[i];
+
+                    derivative_real = new_derivative_real;
+                    derivative_imag = new_derivative_imag;
+
+                    value_real = new_value_real;
+                    value_imag = new_value_imag;
+                }
+
+                /*
+                    NOTE: Dividing by hand takes a single real division,
+                    where 'std::complex' guards against overflow with
+                    a call which is many times slower, and which can't
+                    be vectorized. Numbers where the derivative is zero
+                    become NaN, and so just never converge.
+                */
+                const auto inverse_magnitude_sq = simd::broadcast<Value>(1.0_scalar) / (derivative_real * derivative_real + derivative_imag * derivative_imag);
+
+                const auto quotient_real = (value_real * derivative_real + value_imag * derivative_imag) * inverse_magnitude_sq;
+                const auto quotient_imag = (value_imag * derivative_real - value_real * derivative_imag) * inverse_magnitude_sq;
+
+                real = real - (self.relaxation_real * quotient_real - self.relaxation_imag * quotient_imag) + constant_real;
+                imag = imag - (self.relaxation_real * quotient_imag + self.relaxation_imag * quotient_real) + constant_imag;
+            }
+        };
+
+        /*
+            Iterates a point until it's within our tolerance of one
+            of the roots, or, if we aren't finding roots, until it
+            moves less than our tolerance in a single iteration.
+        */
+        template<std::size_t MaxIterations, bool FindRoots, std::size_t Degree, typename Value>
+        [[gnu::always_inline]]
+        constexpr juliet::convergence_result converge_point(
+            Value real,
+            Value imag,
+
+            const Value constant_real,
+            const Value constant_imag,
+
+            const impl::newton_lanes<Degree, Value> &newton
+        ) {
+            for (const auto i : std::views::iota(0uz, MaxIterations)) {
+                [[maybe_unused]] const auto previous_real = real;
+                [[maybe_unused]] const auto previous_imag = imag;
+
+                newton.step(real, imag, constant_real, constant_imag);
+
+                if constexpr (FindRoots) {
+                    for (const auto root : std::views::iota(0uz, Degree)) {
+                        const auto diff_real = real - newton.roots_real[root];
+                        const auto diff_imag = imag - newton.roots_imag[root];
+
+                        if (diff_real * diff_real + diff_imag * diff_imag <= newton.tolerance_sq) {
+                            return {i, root};
+                        }
+                    }
+                } else {
+                    const auto diff_real = real - previous_real;
+                    const auto diff_imag = imag - previous_imag;
+
+                    if (diff_real * diff_real + diff_imag * diff_imag <= newton.tolerance_sq) {
+                        return {i, juliet::convergence_result::no_root};
+                    }
+                }
+            }
+
+            return {MaxIterations, juliet::convergence_result::no_root};
+        }
+
+        /* Like 'converge_point', but for every lane in lockstep, as with 'iterate_lanes'. */
+        template<std::size_t MaxIterations, bool FindRoots, std::size_t Degree, typename Vector>
+        [[gnu::always_inline]]
+        constexpr juliet::convergences_batch<simd::width_of<Vector>> converge_lanes(
+            Vector real,
+            Vector imag,
+
+            const Vector &constant_real,
+            const Vector &constant_imag,
+
+            const impl::newton_lanes<Degree, Vector> &newton
+        ) {
+            using Mask = simd::mask_for<Vector>;
+
+            /* NOTE: Unconverged lanes have all their bits set, and so subtracting them counts up. */
+            auto unconverged = ~Mask{};
+            auto iterations  = Mask{};
+
+            /* NOTE: All bits set becomes 'no_root' once stored. */
+            [[maybe_unused]] auto roots = ~Mask{};
+
+            for (const auto _ : std::views::iota(0uz, MaxIterations)) {
+                [[maybe_unused]] const auto previous_real = real;
+                [[maybe_unused]] const auto previous_imag = imag;
+
+                newton.step(real, imag, constant_real, constant_imag);
+
+                if constexpr (FindRoots) {
+                    for (const auto root : std::views::iota(0uz, Degree)) {
+                        const auto diff_real = real - newton.roots_real[root];
+                        const auto diff_imag = imag - newton.roots_imag[root];
+
+                        const auto converged = unconverged & (diff_real * diff_real + diff_imag * diff_imag <= newton.tolerance_sq);
+
+                        roots        = converged ? simd::broadcast<Mask>(root) : roots;
+                        unconverged &= ~converged;
+                    }
+                } else {
+                    const auto diff_real = real - previous_real;
+                    const auto diff_imag = imag - previous_imag;
+
+                    /* NOTE: Lanes which have become NaN compare false either way, and so shouldn't count as converged. */
+                    unconverged &= ~(diff_real * diff_real + diff_imag * diff_imag <= newton.tolerance_sq);
+                }
+
+                if (!simd::any(unconverged)) {
+                    break;
+                }
+
+                iterations -= unconverged;
+            }
+
+            const auto lane_iterations = simd::store<std::size_t>(iterations);
+            const auto lane_roots      = simd::store<std::size_t>(roots);
+
+            auto convergences = juliet::convergences_batch<simd::width_of<Vector>>{};
+            for (const auto i : std::views::iota(0uz, convergences.size())) {
+                if constexpr (FindRoots) {
+                    convergences[i] = {lane_iterations[i], lane_roots[i]};
+                } else {
+                    convergences[i] = {lane_iterations[i], juliet::convergence_result::no_root};
+                }
+            }
+
+            return convergences;
+        }
+
+    }
+
+    /*
+        The basins of attraction of Newton's method for finding the
+        roots of a polynomial, optionally relaxed by multiplying
+        each step by a complex factor.
+    */
+    template<std::size_t Degree, typename Scalar = juliet::scalar>
+    struct basic_newton_set {
+        using scalar = Scalar;
+
+        juliet::polynomial<Degree> polynomial = juliet::polynomial<Degree>::roots_of_unity();
+
+        juliet::complex relaxation = 1.0_scalar;
+
+        /* NOTE: How close numbers must get to a root to count as having converged to it. */
+        juliet::scalar tolerance = 1e-6_scalar;
+
+        template<typename OtherScalar>
+        constexpr basic_newton_set<Degree, OtherScalar> with_scalar(this const basic_newton_set &self) {
+            return {self.polynomial, self.relaxation, self.tolerance};
+        }
+
+        template<std::size_t MaxIterations>
+        constexpr juliet::convergence_result iterations_before_convergence(this const basic_newton_set &self, const juliet::complex_for<Scalar> &num) {
+            return impl::converge_point<MaxIterations, true>(
+                num.real(),
+                num.imag(),
+
+                Scalar{},
+                Scalar{},
+
+                impl::newton_lanes<Degree, Scalar>(self.polynomial, self.relaxation, self.tolerance)
+            );
+        }
+
+        template<std::size_t MaxIterations, std::size_t Width>
+        requires (std::has_single_bit(Width) && simd::vectorizable<Scalar>)
+        constexpr juliet::convergences_batch<Width> iterations_before_convergence(this const basic_newton_set &self, const juliet::complex_batch<Width, Scalar> &nums) {
+            return impl::iterate_batch(nums, [&self]<typename Vector>(const Vector &real, const Vector &imag) {
+                return impl::converge_lanes<MaxIterations, true>(
+                    real,
+                    imag,
+
+                    Vector{},
+                    Vector{},
+
+                    impl::newton_lanes<Degree, Vector>(self.polynomial, self.relaxation, self.tolerance)
+                );
+            });
+        }
+
+        template<std::size_t MaxIterations>
+        constexpr std::size_t iterations_before_escape(this const basic_newton_set &self, const juliet::complex_for<Scalar> &num) {
+            return self.template iterations_before_convergence<MaxIterations>(num).iterations;
+        }
+
+        template<std::size_t MaxIterations, std::size_t Width>
+        requires (std::has_single_bit(Width) && simd::vectorizable<Scalar>)
+        constexpr juliet::iterations_batch<Width> iterations_before_escape(this const basic_newton_set &self, const juliet::complex_batch<Width, Scalar> &nums) {
+            const auto convergences = self.template iterations_before_convergence<MaxIterations>(nums);
+
+            auto iterations = juliet::iterations_batch<Width>{};
+            for (const auto i : std::views::iota(0uz, Width)) {
+                iterations[i] = convergences[i].iterations;
+            }
+
+            return iterations;
+        }
+    };
+
+    template<std::size_t Degree>
+    using newton_set = juliet::basic_newton_set<Degree>;
+
+    template<std::size_t Degree, typename Scalar>
+    using newton_set_for = juliet::basic_newton_set<Degree, Scalar>;
+
+    static_assert(juliet::convergent_set<juliet::newton_set<3>>);
+    static_assert(juliet::batch_iterative_set<juliet::newton_set<3>, juliet::batch_width>);
+    static_assert(juliet::rescalable_set<juliet::newton_set<3>>);
+
+    /*
+        The numbers 'c' for which the relaxed Newton step of a
+        polynomial plus 'c' settles down when starting from 'start'.
+
+        NOTE: The points these settle on move with 'c', and so
+        these don't find which root numbers converged to.
+    */
+    template<std::size_t Degree, typename Scalar = juliet::scalar>
+    struct basic_nova_set {
+        using scalar = Scalar;
+
+        juliet::polynomial<Degree> polynomial = juliet::polynomial<Degree>::roots_of_unity();
+
+        juliet::complex relaxation = 1.0_scalar;
+
+        /* NOTE: How little numbers must move in an iteration to count as having converged. */
+        juliet::scalar tolerance = 1e-6_scalar;
+
+        /*
+            NOTE: Usually a root. With a relaxation of 1 the roots are
+            critical points of the iteration, as its derivative there
+            is '1 - relaxation', but otherwise they're only the usual
+            convention rather than critical points.
+        */
+        juliet::complex start = 1.0_scalar;
+
+        template<typename OtherScalar>
+        constexpr basic_nova_set<Degree, OtherScalar> with_scalar(this const basic_nova_set &self) {
+            return {self.polynomial, self.relaxation, self.tolerance, self.start};
+        }
+
+        template<std::size_t MaxIterations>
+        constexpr juliet::convergence_result iterations_before_convergence(this const basic_nova_set &self, const juliet::complex_for<Scalar> &num) {
+            return impl::converge_point<MaxIterations, false>(
+                static_cast<Scalar>(self.start.real()),
+                static_cast<Scalar>(self.start.imag()),
+
+                num.real(),
+                num.imag(),
+
+                impl::newton_lanes<Degree, Scalar>(self.polynomial, self.relaxation, self.tolerance)
+            );
+        }
+
+        template<std::size_t MaxIterations, std::size_t Width>
+        requires (std::has_single_bit(Width) && simd::vectorizable<Scalar>)
+        constexpr juliet::convergences_batch<Width> iterations_before_convergence(this const basic_nova_set &self, const juliet::complex_batch<Width, Scalar> &nums) {
+            return impl::iterate_batch(nums, [&self]<typename Vector>(const Vector &real, const Vector &imag) {
+                return impl::converge_lanes<MaxIterations, false>(
+                    simd::broadcast<Vector>(self.start.real()),
+                    simd::broadcast<Vector>(self.start.imag()),
+
+                    real,
+                    imag,
+
+                    impl::newton_lanes<Degree, Vector>(self.polynomial, self.relaxation, self.tolerance)
+                );
+            });
+        }
+
+        template<std::size_t MaxIterations>
+        constexpr std::size_t iterations_before_escape(this const basic_nova_set &self, const juliet::complex_for<Scalar> &num) {
+            return self.template iterations_before_convergence<MaxIterations>(num).iterations;
+        }
+
+        template<std::size_t MaxIterations, std::size_t Width>
+        requires (std::has_single_bit(Width) && simd::vectorizable<Scalar>)
+        constexpr juliet::iterations_batch<Width> iterations_before_escape(this const basic_nova_set &self, const juliet::complex_batch<Width, Scalar> &nums) {
+            const auto convergences = self.template iterations_before_convergence<MaxIterations>(nums);
+
+            auto iterations = juliet::iterations_batch<Width>{};
+            for (const auto i : std::views::iota(0uz, Width)) {
+                iterations[i] = convergences[i].iterations;
+            }
+
+            return iterations;
+        }
+    };
+
+    template<std::size_t Degree>
+    using nova_set = juliet::basic_nova_set<Degree>;
+
+    template<std::size_t Degree, typename Scalar>
+    using nova_set_for = juliet::basic_nova_set<Degree, Scalar>;
+
+    static_assert(juliet::convergent_set<juliet::nova_set<3>>);
+    static_assert(juliet::batch_iterative_set<juliet::nova_set<3>, juliet::batch_width>);
+    static_assert(juliet::rescalable_set<juliet::nova_set<3>>);
+
+    namespace test {
+
+        static_assert([]() {
+            const auto cubic = juliet::polynomial<3>::from_roots({{{1.0_scalar, 0.0_scalar}, {2.0_scalar, 0.0_scalar}, {3.0_scalar, 0.0_scalar}}});
+
+            /* NOTE: '(z - 1)(z - 2)(z - 3)' is 'z^3 - 6z^2 + 11z - 6'. */
+            return (
+                cubic.coefficients[0] == -6.0_scalar &&
+                cubic.coefficients[1] == 11.0_scalar &&
+                cubic.coefficients[2] == -6.0_scalar &&
+
+                cubic(4.0_scalar) == 6.0_scalar
+            );
+        }());
+
+        /*
+            NOTE: Around the origin, where the basins of our roots meet,
+            but offset so that no sample lands on the origin itself,
+            where the derivative vanishes and we'd divide by zero.
+        */
+        constexpr inline auto newton_sample_min = juliet::complex{-1.75_scalar, -1.75_scalar};
+        constexpr inline auto newton_sample_max = juliet::complex{ 2.25_scalar,  2.25_scalar};
+
+        template<std::size_t MaxIterations>
+        consteval bool convergence_batch_matches_scalar(const juliet::convergent_set auto &set) {
+            return test::batch_matches_scalar<juliet::set_scalar<decltype(set)>>(
+                [&](const auto &nums) {
+                    return juliet::batch_iterations_before_convergence<MaxIterations>(set, nums);
+                },
+
+                [&](const auto &num) {
+                    return set.template iterations_before_convergence<MaxIterations>(num);
+                },
+
+                test::newton_sample_min,
+                test::newton_sample_max
+            );
+        }
+
+        static_assert(convergence_batch_matches_scalar<100>(juliet::newton_set<3>{}));
+        static_assert(convergence_batch_matches_scalar<100>(juliet::newton_set<5>{}));
+        static_assert(convergence_batch_matches_scalar<100>(juliet::newton_set<4>{}.with_scalar<std::float32_t>()));
+        static_assert(convergence_batch_matches_scalar<100>(juliet::newton_set<3>{.relaxation = {1.5_scalar, 0.2_scalar}}));
+        static_assert(convergence_batch_matches_scalar<100>(juliet::newton_set_for<3, juliet::double_double>{}));
+
+        static_assert(convergence_batch_matches_scalar<100>(juliet::nova_set<3>{}));
+        static_assert(convergence_batch_matches_scalar<100>(juliet::nova_set<3>{}.with_scalar<std::float32_t>()));
+
+        /* NOTE: The roots of unity are ordered counterclockwise from one. */
+        static_assert(juliet::newton_set<3>{}.iterations_before_convergence<100>(juliet::complex{2.0_scalar,   0.0_scalar}).root == 0);
+        static_assert(juliet::newton_set<3>{}.iterations_before_convergence<100>(juliet::complex{-1.0_scalar,  1.0_scalar}).root == 1);
+        static_assert(juliet::newton_set<3>{}.iterations_before_convergence<100>(juliet::complex{-1.0_scalar, -1.0_scalar}).root == 2);
+
+        static_assert(juliet::nova_set<3>{}.iterations_before_convergence<100>(juliet::complex{0.1_scalar, 0.0_scalar}).iterations < 100);
+
+    }
+
+}
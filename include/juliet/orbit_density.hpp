@@ -0,0 +1,399 @@
+#pragma once
+
+#include <juliet/common.hpp>
+#include <juliet/color.hpp>
+#include <juliet/sets.hpp>
+#include <juliet/render.hpp>
+
+#include <fpng.h>
+
+namespace juliet {
+
+    /* The orbit lengths, from the minimum up to but not including the maximum, counted towards one channel of a density render. */
+    struct iteration_band {
+        std::size_t min_iterations;
+        std::size_t max_iterations;
+
+        constexpr bool contains(this const iteration_band self, const std::size_t iterations) {
+            return iterations >= self.min_iterations && iterations < self.max_iterations;
+        }
+    };
+
+    enum class orbit_sampling {
+        /* Numbers are spread uniformly at random across the sampled region. */
+        random,
+
+        /*
+            The sampled region is split into a square grid with one number
+            placed randomly in each cell, which converges with fewer samples.
+
+            NOTE: When the number of samples isn't a perfect square,
+            those left over after the grid are spread at random.
+        */
+        stratified,
+    };
+
+    /* How many times orbits passed through each pixel, for each band. */
+    template<std::size_t NumBands>
+    struct orbit_histogram {
+        juliet::resolution resolution;
+
+        /*
+            NOTE: Each band's counts are contiguous, so that they can be merged
+            in a single pass. They're 64-bit since the densest pixels of renders
+            with billions of samples would overflow anything narrower.
+        */
+        std::vector<std::uint64_t> counts;
+
+        constexpr explicit orbit_histogram(const juliet::resolution resolution)
+        :
+            resolution(resolution),
+            counts(static_cast<std::size_t>(resolution.area()) * NumBands, 0)
+        {}
+
+        std::size_t _index_of(this const orbit_histogram &self, const std::size_t band, const juliet::coords coords) {
+            return band * static_cast<std::size_t>(self.resolution.area()) + static_cast<std::size_t>(coords.y * self.resolution.width() + coords.x);
+        }
+
+        std::uint64_t count(this const orbit_histogram &self, const std::size_t band, const juliet::coords coords) {
+            return self.counts[self._index_of(band, coords)];
+        }
+
+        void add(this orbit_histogram &self, const std::size_t band, const juliet::coords coords) {
+            ++self.counts[self._index_of(band, coords)];
+        }
+
+        void clear(this orbit_histogram &self) {
+            std::ranges::fill(self.counts, 0);
+        }
+
+        /*
+            Adds the counts of 'other' for the pixels with indices between
+            'start_index' and 'end_index', so that merging histograms can
+            be split up between threads without them ever contending.
+        */
+        void merge_range(this orbit_histogram &self, const orbit_histogram &other, const std::size_t start_index, const std::size_t end_index) {
+            const auto area = static_cast<std::size_t>(self.resolution.area());
+
+            for (const auto band : std::views::iota(0uz, NumBands)) {
+                for (const auto i : std::views::iota(band * area + start_index, band * area + end_index)) {
+                    self.counts[i] += other.counts[i];
+                }
+            }
+        }
+    };
+
+    namespace impl {
+
+        /* NOTE: See https://prng.di.unimi.it/splitmix64.c */
+        constexpr std::uint64_t splitmix(std::uint64_t state) {
+            state += 0x9E3779B97F4A7C15;
+
+            state = (state ^ (state >> 30)) * 0xBF58476D1CE4E5B9;
+            state = (state ^ (state >> 27)) * 0x94D049BB133111EB;
+
+            return state ^ (state >> 31);
+        }
+
+        /*
+            A random scalar in '[0, 1)' for each index and seed.
+
+            NOTE: Hashing the index instead of advancing a generator
+            means every sample is the same no matter which thread
+            draws it, so renders don't depend on the thread count.
+        */
+        constexpr juliet::scalar random_unit(const std::uint64_t seed, const std::uint64_t index) {
+            static constexpr auto Mantissa = 0x1p-53_scalar;
+
+            const auto bits = impl::splitmix(impl::splitmix(seed) ^ index);
+
+            return static_cast<juliet::scalar>(bits >> 11) * Mantissa;
+        }
+
+        /* The largest number whose square is at most 'num'. */
+        constexpr std::size_t integer_sqrt(const std::size_t num) {
+            /* NOTE: The floating-point root can be off by one for large numbers, which we then correct. */
+            auto root = static_cast<std::size_t>(std::sqrt(static_cast<juliet::scalar>(num)));
+
+            while (root > 0 && root * root > num) {
+                --root;
+            }
+
+            while ((root + 1) * (root + 1) <= num) {
+                ++root;
+            }
+
+            return root;
+        }
+
+    }
+
+    /*
+        Renders how densely the orbits of sampled numbers pass through
+        each pixel, which for the Mandelbrot set is the Buddhabrot.
+
+        Each band makes up a channel of the final image, plotting only
+        the orbits whose lengths it contains, e.g. to render the
+        Nebulabrot with three bands of increasing lengths.
+
+        NOTE: The max iterations are the largest of the bands', rounded
+        up to the nearest of the 'precompiled_max_iterations'.
+    */
+    template<std::size_t NumBands = 1>
+    requires (NumBands == 1 || NumBands == 3)
+    struct orbit_density_renderer {
+        using histogram_type = juliet::orbit_histogram<NumBands>;
+
+        juliet::resolution _resolution;
+        juliet::frame      _frame;
+
+        histogram_type _histogram;
+
+        std::array<juliet::iteration_band, NumBands> bands;
+
+        /*
+            NOTE: For the anti-Buddhabrot, which plots the orbits
+            which never escape instead. As those orbits are all
+            the same length, the bands instead pick which of
+            the iterations of each orbit get plotted.
+        */
+        bool anti = false;
+
+        juliet::orbit_sampling sampling = juliet::orbit_sampling::stratified;
+
+        /* NOTE: The corners of the region numbers are sampled from, which every escaping orbit of the Mandelbrot set starts in. */
+        juliet::complex sample_min = {-2.0_scalar, -2.0_scalar};
+        juliet::complex sample_max = { 2.0_scalar,  2.0_scalar};
+
+        constexpr orbit_density_renderer(const juliet::resolution resolution, const juliet::frame &frame, const std::array<juliet::iteration_band, NumBands> &bands)
+        :
+            _resolution(resolution),
+            _frame(frame),
+            _histogram(resolution),
+            bands(bands)
+        {}
+
+        juliet::resolution resolution(this const orbit_density_renderer &self) {
+            return self._resolution;
+        }
+
+        juliet::frame frame(this const orbit_density_renderer &self) {
+            return self._frame;
+        }
+
+        auto &histogram(this auto &self) {
+            return self._histogram;
+        }
+
+        std::size_t max_iterations(this const orbit_density_renderer &self) {
+            return std::ranges::max(self.bands | std::views::transform(&juliet::iteration_band::max_iterations));
+        }
+
+        constexpr juliet::complex sample_number(this const orbit_density_renderer &self, const std::size_t num_samples, const std::size_t index, const std::uint64_t seed) {
+            const auto jitter_real = impl::random_unit(seed, 2 * index + 0);
+            const auto jitter_imag = impl::random_unit(seed, 2 * index + 1);
+
+            const auto [unit_real, unit_imag] = [&]() -> std::pair<juliet::scalar, juliet::scalar> {
+                if (self.sampling == juliet::orbit_sampling::random) {
+                    return {jitter_real, jitter_imag};
+                }
+
+                const auto cells_per_side = impl::integer_sqrt(num_samples);
+
+                if (index >= cells_per_side * cells_per_side) {
+                    return {jitter_real, jitter_imag};
+                }
+
+                const auto cell_real = static_cast<juliet::scalar>(index % cells_per_side);
+                const auto cell_imag = static_cast<juliet::scalar>(index / cells_per_side);
+
+                return {
+                    (cell_real + jitter_real) / static_cast<juliet::scalar>(cells_per_side),
+                    (cell_imag + jitter_imag) / static_cast<juliet::scalar>(cells_per_side)
+                };
+            }();
+
+            return {
+                self.sample_min.real() + unit_real * (self.sample_max.real() - self.sample_min.real()),
+                self.sample_min.imag() + unit_imag * (self.sample_max.imag() - self.sample_min.imag())
+            };
+        }
+
+        template<std::size_t MaxIterations>
+        void _plot_orbit(
+            this const orbit_density_renderer &self,
+            const juliet::orbit_tracing_set auto &set,
+            const juliet::complex_for<juliet::set_scalar<decltype(set)>> &num,
+            const std::size_t iterations,
+
+            histogram_type &histogram
+        ) {
+            if (self.anti) {
+                if (iterations < MaxIterations) {
+                    return;
+                }
+            } else {
+                const auto in_any_band = std::ranges::any_of(self.bands, [&](const juliet::iteration_band band) {
+                    return band.contains(iterations);
+                });
+
+                if (iterations >= MaxIterations || !in_any_band) {
+                    return;
+                }
+            }
+
+            auto iteration = 0uz;
+            set.template trace_orbit<MaxIterations>(num, [&](const auto &value) {
+                const auto coords = self._frame.screen_coords_at_number(self._resolution, juliet::complex_cast<juliet::scalar>(value));
+
+                if (coords.has_value()) {
+                    const auto band_key = self.anti ? iteration : iterations;
+
+                    for (const auto band : std::views::iota(0uz, NumBands)) {
+                        if (self.bands[band].contains(band_key)) {
+                            histogram.add(band, *coords);
+                        }
+                    }
+                }
+
+                ++iteration;
+            });
+        }
+
+        /*
+            Accumulates the orbits of the samples with indices between
+            'start_index' and 'end_index' into 'histogram', out of a
+            render of 'num_samples' in total.
+
+            NOTE: The samples are first iterated a batch at a time
+            just to find how long their orbits are, and only those
+            which will actually be plotted are then traced.
+        */
+        void accumulate_samples(
+            this const orbit_density_renderer &self,
+            const juliet::orbit_tracing_set auto &set,
+
+            histogram_type &histogram,
+
+            const std::size_t num_samples,
+            const std::size_t start_index,
+            const std::size_t end_index,
+
+            const std::uint64_t seed
+        ) {
+            using Scalar = juliet::set_scalar<decltype(set)>;
+
+            static constexpr auto Width = juliet::batch_width_for<Scalar>;
+
+            juliet::with_precompiled_max_iterations(self.max_iterations(), [&]<std::size_t MaxIterations>() {
+                auto nums = juliet::complex_batch<Width, Scalar>{};
+
+                for (const auto batch_start : std::views::iota(start_index, end_index) | std::views::stride(Width)) {
+                    const auto num_filled = std::min(Width, end_index - batch_start);
+
+                    /* NOTE: We pad out the last batch by repeating its last sample. */
+                    for (const auto i : std::views::iota(0uz, Width)) {
+                        nums.store(i, juliet::complex_cast<Scalar>(self.sample_number(num_samples, batch_start + std::min(i, num_filled - 1), seed)));
+                    }
+
+                    nums.num_filled = num_filled;
+
+                    const auto iterations = juliet::batch_iterations_before_escape<MaxIterations>(set, nums);
+
+                    for (const auto i : std::views::iota(0uz, num_filled)) {
+                        self.template _plot_orbit<MaxIterations>(set, nums[i], iterations[i], histogram);
+                    }
+                }
+            });
+        }
+
+        void render_orbit_density(this orbit_density_renderer &self, const juliet::orbit_tracing_set auto &set, const std::size_t num_samples, const std::uint64_t seed) {
+            self._histogram.clear();
+
+            self.accumulate_samples(set, self._histogram, num_samples, 0, num_samples, seed);
+        }
+
+        /* NOTE: Each band is brightest where it's densest, with a square root so that sparser parts still show. */
+        std::vector<color::rgb> pixels(this const orbit_density_renderer &self) {
+            const auto area = static_cast<std::size_t>(self._resolution.area());
+
+            auto max_counts = std::array<std::uint64_t, NumBands>{};
+            for (const auto band : std::views::iota(0uz, NumBands)) {
+                const auto band_counts = std::span(self._histogram.counts).subspan(band * area, area);
+
+                max_counts[band] = std::max(std::ranges::max(band_counts), std::uint64_t{1});
+            }
+
+            const auto brightness = [&](const std::size_t band, const std::size_t index) {
+                const auto density = static_cast<std::float32_t>(self._histogram.counts[band * area + index]) / static_cast<std::float32_t>(max_counts[band]);
+
+                return static_cast<std::uint8_t>(255.0f32 * std::sqrt(density));
+            };
+
+            auto pixels = std::vector<color::rgb>(area);
+            for (const auto i : std::views::iota(0uz, area)) {
+                if constexpr (NumBands == 1) {
+                    pixels[i] = color::rgb::gray(brightness(0, i));
+                } else {
+                    pixels[i] = {brightness(0, i), brightness(1, i), brightness(2, i)};
+                }
+            }
+
+            return pixels;
+        }
+
+        void save_png(this const orbit_density_renderer &self, const char *path) {
+            const auto pixels = self.pixels();
+
+            /* NOTE: It's okay to call this multiple times. */
+            fpng::fpng_init();
+
+            fpng::fpng_encode_image_to_file(
+                path,
+                pixels.data(),
+
+                static_cast<std::uint32_t>(self._resolution.width()),
+                static_cast<std::uint32_t>(self._resolution.height()),
+
+                3
+            );
+        }
+    };
+
+    namespace test {
+
+        static_assert(juliet::iteration_band{20, 100}.contains(20));
+        static_assert(!juliet::iteration_band{20, 100}.contains(100));
+
+        static_assert(impl::random_unit(1, 2) != impl::random_unit(1, 3));
+        static_assert(impl::random_unit(1, 2) != impl::random_unit(2, 2));
+        static_assert(impl::random_unit(1, 2) >= 0.0_scalar && impl::random_unit(1, 2) < 1.0_scalar);
+
+        static_assert(impl::integer_sqrt(0) == 0);
+        static_assert(impl::integer_sqrt(8) == 2);
+        static_assert(impl::integer_sqrt(9) == 3);
+        static_assert(impl::integer_sqrt((std::size_t{1} << 32) - 1) == (std::size_t{1} << 16) - 1);
+
+        /* NOTE: With ten samples, the first nine fill every cell of a 3x3 grid, top row included, and the last lands anywhere. */
+        static_assert([]() {
+            auto renderer = juliet::orbit_density_renderer<>({4, 4}, juliet::frame::complete({4, 4}), {{{0, 100}}});
+
+            renderer.sample_min = {0.0_scalar, 0.0_scalar};
+            renderer.sample_max = {3.0_scalar, 3.0_scalar};
+
+            for (const auto i : std::views::iota(0uz, 9uz)) {
+                const auto num = renderer.sample_number(10, i, 1);
+
+                if (std::floor(num.real()) != static_cast<juliet::scalar>(i % 3) || std::floor(num.imag()) != static_cast<juliet::scalar>(i / 3)) {
+                    return false;
+                }
+            }
+
+            const auto leftover = renderer.sample_number(10, 9, 1);
+
+            return leftover.real() >= 0.0_scalar && leftover.real() < 3.0_scalar && leftover.imag() >= 0.0_scalar && leftover.imag() < 3.0_scalar;
+        }());
+
+    }
+
+}
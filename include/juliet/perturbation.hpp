@@ -0,0 +1,477 @@
+#pragma once
+
+#include <juliet/common.hpp>
+#include <juliet/floatexp.hpp>
+#include <juliet/bigfixed.hpp>
+#include <juliet/sets.hpp>
+#include <juliet/render.hpp>
+
+namespace juliet {
+
+    /*
+        The orbit of a single reference point, iterated in
+        high precision and then stored rounded to scalars.
+
+        Nearby points are then iterated as small deltas from
+        this orbit, which scalars are precise enough for.
+
+        See https://mathr.co.uk/blog/2021-05-14_deep_zoom_theory_and_practice.html
+    */
+    struct reference_orbit {
+        /* The reference point's offset from the origin of its set. */
+        juliet::complex offset;
+
+        /* NOTE: Starts with 'Z_0 = 0', and stops once the orbit escapes or runs out of iterations. */
+        std::vector<juliet::complex> orbit;
+
+        /* NOTE: 'tolerance^2 * |Z_n|^2', below which a perturbed orbit has lost too much precision against ours. */
+        std::vector<juliet::scalar> glitch_magnitudes_sq;
+
+        static constexpr reference_orbit compute(
+            const juliet::bigfixed_complex &point,
+            const juliet::complex offset,
+            const std::size_t max_iterations,
+            const juliet::scalar glitch_tolerance
+        ) {
+            static constexpr auto EscapeMagnitudeSquared = 2.0_scalar * 2.0_scalar;
+
+            const auto glitch_tolerance_sq = glitch_tolerance * glitch_tolerance;
+
+            auto reference = reference_orbit{offset, {}, {}};
+
+            reference.orbit.reserve(max_iterations + 1);
+            reference.glitch_magnitudes_sq.reserve(max_iterations + 1);
+
+            reference.orbit.emplace_back();
+            reference.glitch_magnitudes_sq.emplace_back();
+
+            auto z = juliet::bigfixed_complex{
+                juliet::bigfixed(point.num_fraction_limbs()),
+                juliet::bigfixed(point.num_fraction_limbs()),
+            };
+
+            for (auto _ : std::views::iota(0uz, max_iterations)) {
+                const auto real_sq = z.real * z.real;
+                const auto imag_sq = z.imag * z.imag;
+                const auto cross   = z.real * z.imag;
+
+                z.imag = cross + cross + point.imag;
+                z.real = real_sq - imag_sq + point.real;
+
+                const auto rounded      = z.to_complex();
+                const auto magnitude_sq = std::norm(rounded);
+
+                reference.orbit.push_back(rounded);
+                reference.glitch_magnitudes_sq.push_back(glitch_tolerance_sq * magnitude_sq);
+
+                if (magnitude_sq > EscapeMagnitudeSquared) {
+                    break;
+                }
+            }
+
+            return reference;
+        }
+
+        /*
+            Returns nothing if the perturbed orbit glitched, or
+            if it outlived our orbit, and so needs another reference.
+
+            If we aren't detecting glitches, then we just accept
+            whatever we get, taking outliving our orbit as escaping.
+
+            NOTE: 'Delta' may be 'juliet::floatexp' for deltas
+            too small to be held by scalars. Our orbit itself
+            stays in scalars since it never strays far from zero.
+        */
+        template<std::size_t MaxIterations, bool DetectGlitches = true, typename Delta = juliet::scalar>
+        constexpr std::optional<std::size_t> perturbed_iterations_before_escape(
+            this const reference_orbit &self,
+
+            const Delta delta_constant_real,
+            const Delta delta_constant_imag
+        ) {
+            static constexpr auto EscapeMagnitudeSquared = 2.0_scalar * 2.0_scalar;
+
+            const auto last_index = self.orbit.size() - 1;
+
+            auto delta_real = Delta{};
+            auto delta_imag = Delta{};
+
+            for (const auto i : std::views::iota(0uz, MaxIterations)) {
+                if (i >= last_index) {
+                    if constexpr (DetectGlitches) {
+                        return std::nullopt;
+                    } else {
+                        return i;
+                    }
+                }
+
+                const auto reference = self.orbit[i];
+
+                /* NOTE: 'delta' becomes '2 * Z * delta + delta^2 + delta_constant', i.e. '(2 * Z + delta) * delta + delta_constant'. */
+                const auto factor_real = Delta{reference.real() + reference.real()} + delta_real;
+                const auto factor_imag = Delta{reference.imag() + reference.imag()} + delta_imag;
+
+                const auto new_delta_real = factor_real * delta_real - factor_imag * delta_imag + delta_constant_real;
+                const auto new_delta_imag = factor_real * delta_imag + factor_imag * delta_real + delta_constant_imag;
+
+                delta_real = new_delta_real;
+                delta_imag = new_delta_imag;
+
+                const auto next_reference = self.orbit[i + 1];
+
+                /* NOTE: Wherever the delta would be too small for scalars, it's also too small to matter here. */
+                const auto real = next_reference.real() + static_cast<juliet::scalar>(delta_real);
+                const auto imag = next_reference.imag() + static_cast<juliet::scalar>(delta_imag);
+
+                const auto magnitude_sq = real * real + imag * imag;
+
+                if (magnitude_sq > EscapeMagnitudeSquared) {
+                    return i;
+                }
+
+                if constexpr (DetectGlitches) {
+                    if (magnitude_sq < self.glitch_magnitudes_sq[i + 1]) {
+                        return std::nullopt;
+                    }
+                }
+            }
+
+            return MaxIterations;
+        }
+    };
+
+    namespace impl {
+
+        struct secondary_references {
+            std::mutex mutex;
+
+            /* NOTE: References are only ever added, so pointers to them stay valid. */
+            std::vector<std::unique_ptr<const juliet::reference_orbit>> references;
+
+            /* NOTE: Includes the references still being computed, which haven't been added yet. */
+            std::size_t num_reserved = 0;
+
+            /* NOTE: Constant evaluation only ever has the one thread, and can't lock a mutex anyways. */
+            constexpr decltype(auto) _locked(this secondary_references &self, const auto &callback) {
+                if consteval {
+                    return callback();
+                } else {
+                    const auto lock = std::scoped_lock(self.mutex);
+
+                    return callback();
+                }
+            }
+
+            constexpr std::vector<const juliet::reference_orbit *> snapshot(this secondary_references &self) {
+                return self._locked([&]() {
+                    return std::vector<const juliet::reference_orbit *>(
+                        std::from_range,
+
+                        self.references | std::views::transform([](const auto &reference) {
+                            return reference.get();
+                        })
+                    );
+                });
+            }
+
+            /*
+                Claims room for another reference, returning whether
+                there was any left. Checking and claiming together
+                keeps threads from all making the last reference.
+            */
+            constexpr bool reserve(this secondary_references &self, const std::size_t max_references) {
+                return self._locked([&]() {
+                    if (self.num_reserved >= max_references) {
+                        return false;
+                    }
+
+                    ++self.num_reserved;
+
+                    return true;
+                });
+            }
+
+            /* NOTE: Room for the reference should already have been reserved. */
+            constexpr void add(this secondary_references &self, std::unique_ptr<const juliet::reference_orbit> reference) {
+                self._locked([&]() {
+                    self.references.push_back(std::move(reference));
+                });
+            }
+        };
+
+    }
+
+    /* A 'deep_mandelbrot_set' which has computed its reference orbit for a particular frame. */
+    struct perturbed_mandelbrot_set {
+        juliet::bigfixed_complex origin;
+        std::int64_t             delta_exponent;
+
+        /* NOTE: Whether our deltas are too small for scalars and so need 'juliet::floatexp'. */
+        bool extended_range;
+
+        std::size_t    max_iterations;
+        juliet::scalar glitch_tolerance;
+        std::size_t    max_secondary_references;
+
+        juliet::reference_orbit primary;
+
+        /* NOTE: Behind a pointer since its mutex can't be moved, which we need to be. */
+        std::unique_ptr<impl::secondary_references> secondary;
+
+        template<std::size_t MaxIterations>
+        constexpr std::size_t iterations_before_escape(this const perturbed_mandelbrot_set &self, const juliet::complex num) {
+            if (self.extended_range) {
+                return self._iterations_before_escape<MaxIterations, juliet::floatexp>(num);
+            }
+
+            return self._iterations_before_escape<MaxIterations, juliet::scalar>(num);
+        }
+
+        template<std::size_t MaxIterations, bool DetectGlitches, typename Delta>
+        constexpr std::optional<std::size_t> _perturbed_iterations_before_escape(
+            this const perturbed_mandelbrot_set &self,
+
+            const juliet::reference_orbit &reference,
+            const juliet::complex num
+        ) {
+            const auto delta_constant = num - reference.offset;
+
+            const auto delta_constant_real = juliet::floatexp::from_parts(delta_constant.real(), self.delta_exponent);
+            const auto delta_constant_imag = juliet::floatexp::from_parts(delta_constant.imag(), self.delta_exponent);
+
+            return reference.template perturbed_iterations_before_escape<MaxIterations, DetectGlitches>(
+                static_cast<Delta>(delta_constant_real),
+                static_cast<Delta>(delta_constant_imag)
+            );
+        }
+
+        template<std::size_t MaxIterations, typename Delta>
+        constexpr std::size_t _iterations_before_escape(this const perturbed_mandelbrot_set &self, const juliet::complex num) {
+            const auto iterations = self._perturbed_iterations_before_escape<MaxIterations, true, Delta>(self.primary, num);
+            if (iterations.has_value()) {
+                return *iterations;
+            }
+
+            const auto references = self.secondary->snapshot();
+
+            /* NOTE: Newer references were made for glitches which are more likely to be near us. */
+            for (const auto *reference : references | std::views::reverse) {
+                const auto iterations = self._perturbed_iterations_before_escape<MaxIterations, true, Delta>(*reference, num);
+                if (iterations.has_value()) {
+                    return *iterations;
+                }
+            }
+
+            if (self.secondary->reserve(self.max_secondary_references)) {
+                /*
+                    NOTE: A reference at our own point can't glitch for
+                    us, and will likely also fix our glitched neighbors.
+                */
+                auto reference = std::make_unique<const juliet::reference_orbit>(juliet::reference_orbit::compute(
+                    self.origin + juliet::bigfixed_complex::from_scaled_complex(num, self.delta_exponent, self.origin.num_fraction_limbs()),
+
+                    num,
+
+                    self.max_iterations,
+                    self.glitch_tolerance
+                ));
+
+                const auto iterations = self._perturbed_iterations_before_escape<MaxIterations, false, Delta>(*reference, num);
+
+                self.secondary->add(std::move(reference));
+
+                return *iterations;
+            }
+
+            /* NOTE: We're out of references to make, so we just accept the glitch. */
+            return *self._perturbed_iterations_before_escape<MaxIterations, false, Delta>(self.primary, num);
+        }
+    };
+
+    static_assert(juliet::iterative_set<juliet::perturbed_mandelbrot_set>);
+
+    /*
+        The Mandelbrot set, rendered with perturbation theory
+        so that it can be zoomed far deeper than scalars allow.
+
+        Frames rendered with this set are taken relative to
+        our high-precision origin and scaled by '2^delta_exponent',
+        so that they only ever need to be precise relative to
+        their pixel scale, and never leave the range of scalars.
+        Use 'rebased' to move a frame into our origin and exponent.
+    */
+    struct deep_mandelbrot_set {
+        /*
+            NOTE: Past around here, our deltas come within a few dozen
+            powers of two of the subnormal range of scalars, where
+            multiplying them by the small values near where a reference
+            orbit passes close to zero would start losing precision.
+
+            Their squares underflow far sooner, but by then they're
+            already negligible next to the rest of each delta.
+        */
+        static constexpr std::int64_t ExtendedRangeExponent = -960;
+
+        juliet::bigfixed_complex origin = {};
+
+        std::int64_t delta_exponent = 0;
+
+        /* How much of a reference orbit's magnitude a perturbed orbit may lose before it's considered glitched. */
+        juliet::scalar glitch_tolerance = 1.0e-3_scalar;
+
+        std::size_t max_secondary_references = 32;
+
+        /* Returns the size of the frame's pixels, which are otherwise relative to our exponent. */
+        constexpr juliet::floatexp absolute_pixel_scale(this const deep_mandelbrot_set &self, const juliet::frame &frame) {
+            return juliet::floatexp::from_parts(frame.pixel_scale, self.delta_exponent);
+        }
+
+        /* Returns ourselves with the frame's center as our origin, and the frame which is now equivalent. */
+        constexpr std::pair<deep_mandelbrot_set, juliet::frame> rebased(this deep_mandelbrot_set self, const juliet::frame &frame) {
+            const auto pixel_scale = self.absolute_pixel_scale(frame);
+
+            const auto num_fraction_limbs = std::max(
+                juliet::bigfixed::fraction_limbs_for_scale(pixel_scale),
+
+                self.origin.num_fraction_limbs()
+            );
+
+            self.origin = (
+                self.origin.with_fraction_limbs(num_fraction_limbs) +
+
+                juliet::bigfixed_complex::from_scaled_complex(frame.center, self.delta_exponent, num_fraction_limbs)
+            );
+
+            /* NOTE: We take the exponent of the pixel scale so that frames can keep zooming in without underflowing. */
+            const auto frame_exponent = juliet::floatexp(frame.pixel_scale).exponent;
+
+            self.delta_exponent += frame_exponent;
+
+            return {
+                std::move(self),
+
+                juliet::frame{
+                    juliet::complex{},
+
+                    juliet::floatexp(frame.pixel_scale).mantissa
+                }
+            };
+        }
+
+        constexpr juliet::perturbed_mandelbrot_set for_frame(this const deep_mandelbrot_set &self, const juliet::frame &frame, const std::size_t max_iterations) {
+            const auto pixel_scale = self.absolute_pixel_scale(frame);
+
+            const auto num_fraction_limbs = std::max(
+                juliet::bigfixed::fraction_limbs_for_scale(pixel_scale),
+
+                self.origin.num_fraction_limbs()
+            );
+
+            auto origin = self.origin.with_fraction_limbs(num_fraction_limbs);
+
+            /* NOTE: The center of the frame is as good a guess as any for a point that won't escape early. */
+            auto primary = juliet::reference_orbit::compute(
+                origin + juliet::bigfixed_complex::from_scaled_complex(frame.center, self.delta_exponent, num_fraction_limbs),
+
+                frame.center,
+
+                max_iterations,
+                self.glitch_tolerance
+            );
+
+            return juliet::perturbed_mandelbrot_set{
+                std::move(origin),
+                self.delta_exponent,
+
+                pixel_scale.exponent < ExtendedRangeExponent,
+
+                max_iterations,
+                self.glitch_tolerance,
+                self.max_secondary_references,
+
+                std::move(primary),
+                std::make_unique<impl::secondary_references>()
+            };
+        }
+
+        /*
+            NOTE: Without a frame we have no reference orbit,
+            and so we can only iterate with plain scalars.
+        */
+        template<std::size_t MaxIterations>
+        constexpr std::size_t iterations_before_escape(this const deep_mandelbrot_set &self, const juliet::complex num) {
+            const auto offset = juliet::complex{
+                static_cast<juliet::scalar>(juliet::floatexp::from_parts(num.real(), self.delta_exponent)),
+                static_cast<juliet::scalar>(juliet::floatexp::from_parts(num.imag(), self.delta_exponent))
+            };
+
+            return juliet::mandelbrot_set.template iterations_before_escape<MaxIterations>(self.origin.to_complex() + offset);
+        }
+    };
+
+    static_assert(juliet::frame_dependent_set<juliet::deep_mandelbrot_set>);
+
+    /* NOTE: Once prepared for a frame, preparing again would just waste the work. */
+    static_assert(!juliet::frame_dependent_set<juliet::perturbed_mandelbrot_set>);
+
+    /* Sets whose origin and scale can be moved, so that frames can stay close to them. */
+    template<typename Set>
+    concept rebasable_set = juliet::iterative_set<Set> && requires(const Set &set, const juliet::frame &frame) {
+        { set.rebased(frame) } -> std::same_as<std::pair<std::remove_cvref_t<Set>, juliet::frame>>;
+
+        { set.absolute_pixel_scale(frame) } -> std::same_as<juliet::floatexp>;
+    };
+
+    static_assert(juliet::rebasable_set<juliet::deep_mandelbrot_set>);
+
+    namespace test {
+
+        /*
+            NOTE: The frame is kept off the real axis, where orbits
+            are chaotic enough that rounding alone could change when
+            they escape, and so whether the two paths agree.
+        */
+        static_assert([]() {
+            static constexpr auto MaxIterations = 100uz;
+
+            static constexpr auto Resolution = juliet::resolution{16, 12};
+
+            const auto frame = juliet::frame{{-0.5_scalar, 0.5_scalar}, 0.0625_scalar};
+
+            const auto set = juliet::deep_mandelbrot_set{}.for_frame(frame, MaxIterations);
+
+            for (const auto coords : Resolution.screen_coords()) {
+                const auto num = frame.number_at_screen_coords(Resolution, coords);
+
+                if (set.template iterations_before_escape<MaxIterations>(num) != juliet::mandelbrot_set.template iterations_before_escape<MaxIterations>(num)) {
+                    return false;
+                }
+            }
+
+            return true;
+        }());
+
+        static_assert([]() {
+            static constexpr auto MaxIterations = 64uz;
+
+            /* NOTE: The primary reference at the frame's center escapes after only a few iterations. */
+            const auto set = juliet::deep_mandelbrot_set{}.for_frame(juliet::frame{{0.5_scalar, 0.0_scalar}, 0.0625_scalar}, MaxIterations);
+
+            const auto outliving      = set.template iterations_before_escape<MaxIterations>({0.0_scalar, 0.0_scalar});
+            const auto num_references = set.secondary->references.size();
+
+            /* NOTE: Its neighbor should then use the new reference instead of making another. */
+            const auto neighbor = set.template iterations_before_escape<MaxIterations>({0.0625_scalar, 0.0_scalar});
+
+            return (
+                outliving == MaxIterations && num_references == 1 &&
+                neighbor  == MaxIterations && set.secondary->references.size() == 1 &&
+
+                set.template iterations_before_escape<MaxIterations>({0.5_scalar, 0.0_scalar}) == 4
+            );
+        }());
+
+    }
+
+}
@@ -0,0 +1,240 @@
+#pragma once
+
+#include <juliet/common.hpp>
+#include <juliet/sets.hpp>
+#include <juliet/render.hpp>
+
+namespace juliet {
+
+    /*
+        A grid of numbers which is only ever streamed through and
+        never stored, for when only totals over it are wanted, and
+        so which can be far larger than any image could be.
+    */
+    struct sample_grid {
+        juliet::resolution resolution;
+
+        juliet::frame frame = juliet::frame::complete(resolution);
+
+        /* NOTE: Each sample stands for a square of the plane one pixel across. */
+        constexpr juliet::scalar covered_area(this const sample_grid &self) {
+            return static_cast<juliet::scalar>(self.resolution.area()) * self.frame.pixel_scale * self.frame.pixel_scale;
+        }
+    };
+
+    /*
+        Reduces how many iterations each number took into totals
+        of its own, e.g. a count or a histogram, without keeping
+        any of the numbers.
+
+        NOTE: Threads each reduce into their own empty copy, with
+        nothing reduced into it yet but otherwise the same, e.g. with
+        as many bins, which are merged together afterwards.
+    */
+    template<typename Reducer>
+    concept iteration_reducer = (
+        std::copyable<Reducer> &&
+
+        requires(Reducer &reducer, const Reducer &other, const std::size_t iterations) {
+            reducer.template add<1uz>(iterations);
+
+            reducer.merge(other);
+
+            { other.empty_copy() } -> std::same_as<Reducer>;
+        }
+    );
+
+    /* How many numbers didn't escape, out of how many were reduced. */
+    struct interior_count {
+        std::uint64_t interior = 0;
+        std::uint64_t total    = 0;
+
+        template<std::size_t MaxIterations>
+        constexpr void add(this interior_count &self, const std::size_t iterations) {
+            if (iterations == MaxIterations) {
+                ++self.interior;
+            }
+
+            ++self.total;
+        }
+
+        constexpr void merge(this interior_count &self, const interior_count &other) {
+            self.interior += other.interior;
+            self.total    += other.total;
+        }
+
+        constexpr interior_count empty_copy(this const interior_count &) {
+            return {};
+        }
+
+        /* NOTE: Nothing reduced counts as no interior, rather than dividing by zero. */
+        constexpr juliet::scalar interior_fraction(this const interior_count &self) {
+            if (self.total == 0) {
+                return 0.0_scalar;
+            }
+
+            return static_cast<juliet::scalar>(self.interior) / static_cast<juliet::scalar>(self.total);
+        }
+
+        /* NOTE: When the grid covers the whole set, e.g. with a complete frame for the Mandelbrot set, this estimates its area. */
+        constexpr juliet::scalar area_estimate(this const interior_count &self, const juliet::sample_grid &grid) {
+            return self.interior_fraction() * grid.covered_area();
+        }
+    };
+
+    /* How many numbers took each number of iterations, with those which didn't escape counted last. */
+    struct iteration_histogram {
+        std::vector<std::uint64_t> counts;
+
+        constexpr explicit iteration_histogram(const std::size_t max_iterations) : counts(max_iterations + 1, 0) {}
+
+        /*
+            NOTE: Numbers which didn't escape are counted last even when we have
+            room for more iterations than they were iterated to, and numbers
+            which took longer than we have room for are counted with them.
+        */
+        template<std::size_t MaxIterations>
+        constexpr void add(this iteration_histogram &self, const std::size_t iterations) {
+            const auto last_bin = self.counts.size() - 1;
+
+            if (iterations == MaxIterations) {
+                ++self.counts[last_bin];
+
+                return;
+            }
+
+            ++self.counts[std::min(iterations, last_bin)];
+        }
+
+        constexpr void merge(this iteration_histogram &self, const iteration_histogram &other) {
+            for (const auto i : std::views::iota(0uz, self.counts.size())) {
+                self.counts[i] += other.counts[i];
+            }
+        }
+
+        constexpr iteration_histogram empty_copy(this const iteration_histogram &self) {
+            return iteration_histogram(self.counts.size() - 1);
+        }
+    };
+
+    static_assert(juliet::iteration_reducer<juliet::interior_count>);
+    static_assert(juliet::iteration_reducer<juliet::iteration_histogram>);
+
+    namespace impl {
+
+        /* NOTE: The set should already be prepared for the grid's frame. */
+        template<std::size_t MaxIterations>
+        constexpr void reduce_region_for_frame(
+            const juliet::iterative_set auto &frame_set,
+            const juliet::sample_grid &grid,
+
+            juliet::screen_region auto &&region,
+            juliet::iteration_reducer auto &reducer
+        ) {
+            using Scalar = juliet::set_scalar<decltype(frame_set)>;
+
+            impl::for_each_batch_in_region(
+                grid.frame.template with_scalar<Scalar>(),
+                grid.resolution,
+
+                std::forward<decltype(region)>(region),
+
+                [&](const auto &nums, const auto &, const std::size_t num_filled) {
+                    const auto iterations = juliet::batch_iterations_before_escape<MaxIterations>(frame_set, nums);
+
+                    for (const auto i : std::views::iota(0uz, num_filled)) {
+                        reducer.template add<MaxIterations>(iterations[i]);
+                    }
+                }
+            );
+        }
+
+    }
+
+    /*
+        Reduces the numbers of the grid in the region into the reducer, a batch at a time.
+
+        NOTE: As with renderers, the max iterations are rounded
+        up to the precompiled max iterations.
+    */
+    constexpr void reduce_region(
+        const juliet::iterative_set auto &set,
+        const juliet::sample_grid &grid,
+        const std::size_t max_iterations,
+
+        juliet::screen_region auto &&region,
+        juliet::iteration_reducer auto &reducer
+    ) {
+        juliet::with_precompiled_max_iterations(max_iterations, [&]<std::size_t MaxIterations>() {
+            const auto &frame_set = juliet::set_for_frame(set, grid.frame, MaxIterations);
+
+            impl::reduce_region_for_frame<MaxIterations>(frame_set, grid, std::forward<decltype(region)>(region), reducer);
+        });
+    }
+
+    namespace test {
+
+        /* NOTE: 'MaxIterations' is what 'max_iterations' should be rounded up to. */
+        template<std::size_t MaxIterations>
+        consteval bool reduction_matches_pixels(const juliet::iterative_set auto &set, const juliet::sample_grid &grid, const std::size_t max_iterations = MaxIterations) {
+            const auto area = grid.resolution.area();
+
+            auto expected = juliet::iteration_histogram(MaxIterations);
+            for (const auto coords : grid.resolution.screen_coords()) {
+                expected.add<MaxIterations>(set.template iterations_before_escape<MaxIterations>(grid.frame.number_at_screen_coords(grid.resolution, coords)));
+            }
+
+            auto histogram = juliet::iteration_histogram(MaxIterations);
+            juliet::reduce_region(set, grid, max_iterations, grid.resolution.screen_coords(), histogram);
+
+            /* NOTE: Reduced in two halves and merged, as threads do. */
+            auto count      = juliet::interior_count{};
+            auto half_count = juliet::interior_count{};
+
+            juliet::reduce_region(set, grid, max_iterations, grid.resolution.screen_coords_between(0, area / 2), count);
+            juliet::reduce_region(set, grid, max_iterations, grid.resolution.screen_coords_between(area / 2, area), half_count);
+
+            count.merge(half_count);
+
+            return (
+                histogram.counts == expected.counts &&
+
+                count.total    == static_cast<std::uint64_t>(area) &&
+                count.interior == expected.counts.back()
+            );
+        }
+
+        static_assert(reduction_matches_pixels<250>(juliet::mandelbrot_set, {{25, 25}}));
+        static_assert(reduction_matches_pixels<250>(juliet::quadratic_julia_set{{-0.8_scalar, 0.156_scalar}}, {{31, 17}}, 100));
+
+        static_assert([]() {
+            const auto grid = juliet::sample_grid{{64, 32}};
+
+            const auto count = juliet::interior_count{512, 2'048};
+
+            return grid.covered_area() == 32.0_scalar && count.area_estimate(grid) == 8.0_scalar;
+        }());
+
+        static_assert(juliet::interior_count{}.interior_fraction() == 0.0_scalar);
+
+        static_assert(juliet::interior_count{512, 2'048}.empty_copy().total == 0);
+
+        static_assert([]() {
+            auto histogram = juliet::iteration_histogram(10);
+            histogram.add<10>(3);
+
+            return histogram.empty_copy().counts == std::vector<std::uint64_t>(11, 0);
+        }());
+
+        static_assert([]() {
+            auto histogram = juliet::iteration_histogram(20);
+            histogram.add<10>(10);
+            histogram.add<10>(9);
+
+            return histogram.counts[20] == 1 && histogram.counts[10] == 0 && histogram.counts[9] == 1;
+        }());
+        static_assert(juliet::interior_count{}.area_estimate(juliet::sample_grid{{64, 32}}) == 0.0_scalar);
+
+    }
+
+}
@@ -2,6 +2,9 @@
 
 #include <juliet/common.hpp>
 #include <juliet/sets.hpp>
+#include <juliet/newton.hpp>
+#include <juliet/lyapunov.hpp>
+#include <juliet/floatexp.hpp>
 
 namespace juliet {
 
@@ -58,6 +61,13 @@ namespace juliet {
             return self.width() * self.height();
         }
 
+        constexpr bool contains(this const resolution self, const juliet::coords coords) {
+            return (
+                coords.x >= 0 && coords.x < self.width() &&
+                coords.y >= 0 && coords.y < self.height()
+            );
+        }
+
         constexpr resolution scale(this const resolution self, const juliet::coord scale) {
             return {
                 scale * self.width(),
@@ -77,6 +87,19 @@ namespace juliet {
             return juliet::coords::rectangle({0z, 0z}, {self.width(), self.height()});
         }
 
+        constexpr juliet::screen_region auto screen_coords_between(this const resolution self, const juliet::coord start_index, const juliet::coord end_index) {
+            return (
+                std::views::iota(start_index, end_index) |
+
+                std::views::transform([width = self.width()](const juliet::coord index) {
+                    return juliet::coords{
+                        index % width,
+                        index / width,
+                    };
+                })
+            );
+        }
+
         constexpr juliet::coords to_graphwise_coord(this const resolution self, const juliet::coords coords) {
             return {
                  coords.x - (self.width()  / 2),
@@ -85,32 +108,377 @@ namespace juliet {
         }
     };
 
-    struct frame {
-        juliet::complex center;
-        juliet::scalar  pixel_scale;
+    template<typename Scalar = juliet::scalar>
+    struct basic_frame {
+        using scalar = Scalar;
 
-        static constexpr frame complete(const juliet::resolution resolution) {
+        juliet::complex_for<Scalar> center;
+        Scalar                      pixel_scale;
+
+        static constexpr basic_frame complete(const juliet::resolution resolution) {
             return {
-                juliet::complex{},
+                juliet::complex_for<Scalar>{},
 
-                4.0_scalar / static_cast<juliet::scalar>(resolution.min_length())
+                static_cast<Scalar>(4.0_scalar) / static_cast<Scalar>(resolution.min_length())
             };
         }
 
-        constexpr juliet::complex number_at_screen_coords(this const frame &self, const juliet::resolution resolution, const juliet::coords coords) {
+        /* NOTE: Frames are held in the widest precision they're needed in, and then narrowed for the set they're rendering. */
+        template<typename OtherScalar>
+        constexpr basic_frame<OtherScalar> with_scalar(this const basic_frame &self) {
+            return {
+                juliet::complex_cast<OtherScalar>(self.center),
+
+                static_cast<OtherScalar>(self.pixel_scale)
+            };
+        }
+
+        constexpr juliet::complex_for<Scalar> number_at_screen_coords(this const basic_frame &self, const juliet::resolution resolution, const juliet::coords coords) {
             const auto graph = resolution.to_graphwise_coord(coords);
 
             return (
                 self.center +
 
-                self.pixel_scale * juliet::complex{
-                    static_cast<juliet::scalar>(graph.x),
-                    static_cast<juliet::scalar>(graph.y)
+                self.pixel_scale * juliet::complex_for<Scalar>{
+                    static_cast<Scalar>(graph.x),
+                    static_cast<Scalar>(graph.y)
                 }
             );
         }
+
+        /* The inverse of 'number_at_screen_coords', for numbers which land on the screen. */
+        constexpr std::optional<juliet::coords> screen_coords_at_number(this const basic_frame &self, const juliet::resolution resolution, const juliet::complex_for<Scalar> &num) {
+            const auto offset = num - self.center;
+
+            /* NOTE: We round to the nearest pixel, shifted so that the screen starts at zero. */
+            const auto x = std::floor(static_cast<juliet::scalar>(offset.real() / self.pixel_scale) + 0.5_scalar) + static_cast<juliet::scalar>(resolution.width()  / 2);
+            const auto y = std::floor(static_cast<juliet::scalar>(offset.imag() / self.pixel_scale) + 0.5_scalar) + static_cast<juliet::scalar>(resolution.height() / 2);
+
+            /* NOTE: We check before converting, since numbers far off the screen may not fit in a coord. */
+            if (!(x >= 0.0_scalar && x < static_cast<juliet::scalar>(resolution.width()))) {
+                return std::nullopt;
+            }
+
+            if (!(y >= 0.0_scalar && y < static_cast<juliet::scalar>(resolution.height()))) {
+                return std::nullopt;
+            }
+
+            return juliet::coords{static_cast<juliet::coord>(x), static_cast<juliet::coord>(y)};
+        }
+    };
+
+    using frame = juliet::basic_frame<>;
+
+    static_assert([]() {
+        static constexpr auto Resolution = juliet::resolution{64, 48};
+
+        const auto frame = juliet::frame{{0.5_scalar, -0.25_scalar}, 0.01_scalar};
+
+        for (const auto coords : Resolution.screen_coords()) {
+            const auto found = frame.screen_coords_at_number(Resolution, frame.number_at_screen_coords(Resolution, coords));
+
+            if (!found.has_value() || found->x != coords.x || found->y != coords.y) {
+                return false;
+            }
+        }
+
+        return !frame.screen_coords_at_number(Resolution, juliet::complex{1e300_scalar, 0.0_scalar}).has_value();
+    }());
+
+    static_assert(juliet::resolution{64, 48}.contains({63, 47}));
+    static_assert(!juliet::resolution{64, 48}.contains({64, 0}));
+    static_assert(!juliet::resolution{64, 48}.contains({0, -1}));
+
+    /*
+        A grid of thumbnails of the members of a family of sets,
+        e.g. of Julia sets, with one cell for each constant sampled
+        across the rectangle between 'constant_min' and 'constant_max'.
+
+        NOTE: Moving right through the grid raises the real part of
+        the constant, and moving down raises its imaginary part, the
+        same as moving through the pixels of a frame.
+    */
+    struct julia_atlas {
+        juliet::resolution cells;
+        juliet::resolution thumbnail_resolution;
+
+        juliet::complex constant_min;
+        juliet::complex constant_max;
+
+        /* NOTE: What each thumbnail shows, which by default is the whole of each set. */
+        juliet::frame thumbnail_frame = juliet::frame::complete(thumbnail_resolution);
+
+        constexpr juliet::resolution resolution(this const julia_atlas &self) {
+            return {
+                self.cells.width()  * self.thumbnail_resolution.width(),
+                self.cells.height() * self.thumbnail_resolution.height()
+            };
+        }
+
+        constexpr juliet::coords cell_at_screen_coords(this const julia_atlas &self, const juliet::coords coords) {
+            return {
+                coords.x / self.thumbnail_resolution.width(),
+                coords.y / self.thumbnail_resolution.height()
+            };
+        }
+
+        constexpr juliet::coords thumbnail_coords_at_screen_coords(this const julia_atlas &self, const juliet::coords coords) {
+            return {
+                coords.x % self.thumbnail_resolution.width(),
+                coords.y % self.thumbnail_resolution.height()
+            };
+        }
+
+        /* NOTE: Sampled at the center of the cell, so that the grid is symmetric within the rectangle. */
+        constexpr juliet::complex constant_for_cell(this const julia_atlas &self, const juliet::coords cell) {
+            const auto fraction_real = (static_cast<juliet::scalar>(cell.x) + 0.5_scalar) / static_cast<juliet::scalar>(self.cells.width());
+            const auto fraction_imag = (static_cast<juliet::scalar>(cell.y) + 0.5_scalar) / static_cast<juliet::scalar>(self.cells.height());
+
+            return {
+                self.constant_min.real() + fraction_real * (self.constant_max.real() - self.constant_min.real()),
+                self.constant_min.imag() + fraction_imag * (self.constant_max.imag() - self.constant_min.imag())
+            };
+        }
+    };
+
+    static_assert([]() {
+        const auto atlas = juliet::julia_atlas{{4, 2}, {64, 64}, {-2.0_scalar, -1.0_scalar}, {2.0_scalar, 1.0_scalar}};
+
+        const auto cell = atlas.cell_at_screen_coords({130, 70});
+        const auto thumbnail_coords = atlas.thumbnail_coords_at_screen_coords({130, 70});
+
+        return (
+            atlas.resolution().width() == 256 && atlas.resolution().height() == 128 &&
+
+            cell.x == 2 && cell.y == 1 &&
+            thumbnail_coords.x == 2 && thumbnail_coords.y == 6 &&
+
+            atlas.constant_for_cell({0, 0}) == juliet::complex{-1.5_scalar, -0.5_scalar} &&
+            atlas.constant_for_cell({3, 1}) == juliet::complex{ 1.5_scalar,  0.5_scalar}
+        );
+    }());
+
+    /*
+        Calls 'function.template operator ()<Scalar>()' with the
+        cheapest of our scalars which can still resolve the pixels
+        of the frame, falling back to the most precise one.
+    */
+    template<typename FrameScalar>
+    decltype(auto) with_scalar_for_frame(const juliet::basic_frame<FrameScalar> &frame, auto &&function) {
+        /* NOTE: Iterating magnifies rounding errors, so we want some bits past the pixel scale. */
+        static constexpr int GuardBits = 8;
+
+        const auto magnitude = std::max({
+            std::abs(static_cast<juliet::scalar>(frame.center.real())),
+            std::abs(static_cast<juliet::scalar>(frame.center.imag())),
+
+            2.0_scalar
+        });
+
+        const auto needed_digits = std::ilogb(magnitude) - std::ilogb(static_cast<juliet::scalar>(frame.pixel_scale)) + GuardBits;
+
+        if (needed_digits <= impl::scalar_digits<std::float32_t>) {
+            return function.template operator ()<std::float32_t>();
+        }
+
+        if (needed_digits <= impl::scalar_digits<std::float64_t>) {
+            return function.template operator ()<std::float64_t>();
+        }
+
+        if (needed_digits <= impl::scalar_digits<juliet::double_double>) {
+            return function.template operator ()<juliet::double_double>();
+        }
+
+        return function.template operator ()<juliet::quad_double>();
+    }
+
+    template<typename Frame>
+    concept frame_of_any_scalar = std::same_as<Frame, juliet::basic_frame<typename Frame::scalar>>;
+
+    /*
+        Sets which need to know about the frame they're rendered
+        in and how far they'll be iterated, e.g. to scale tolerances
+        to the pixel size, or to precompute things for the frame.
+    */
+    template<typename Set>
+    concept frame_dependent_set = (
+        juliet::iterative_set<Set> &&
+
+        requires(const Set &set, const juliet::basic_frame<juliet::set_scalar<Set>> &frame, const std::size_t max_iterations) {
+            { set.for_frame(frame, max_iterations) } -> juliet::iterative_set;
+        }
+    );
+
+    /*
+        NOTE: Sets which don't depend on the frame are passed
+        through by reference so that we don't copy them.
+
+        The frame may be in any precision, and is narrowed
+        to the precision of the set.
+    */
+    constexpr decltype(auto) set_for_frame(const juliet::iterative_set auto &set, const juliet::frame_of_any_scalar auto &frame, const std::size_t max_iterations) {
+        if constexpr (juliet::frame_dependent_set<decltype(set)>) {
+            return set.for_frame(frame.template with_scalar<juliet::set_scalar<decltype(set)>>(), max_iterations);
+        } else {
+            return set;
+        }
+    }
+
+    /*
+        The max iterations which kernels and color tables are
+        precompiled for, so that they can be chosen at runtime.
+
+        NOTE: Each is around double the last, so rounding
+        up to one of them never costs much more than asked.
+    */
+    constexpr inline auto precompiled_max_iterations = std::array{
+        250uz, 500uz, 1'000uz, 2'000uz, 5'000uz, 10'000uz, 20'000uz, 50'000uz, 100'000uz
     };
 
+    /*
+        Calls 'function.template operator ()<MaxIterations>()' with
+        the least precompiled max iterations which are at least
+        'max_iterations', or with the greatest if there are none.
+    */
+    template<std::size_t Index = 0uz>
+    constexpr decltype(auto) with_precompiled_max_iterations(const std::size_t max_iterations, auto &&function) {
+        static constexpr auto MaxIterations = juliet::precompiled_max_iterations[Index];
+
+        if constexpr (Index + 1 < juliet::precompiled_max_iterations.size()) {
+            if (max_iterations > MaxIterations) {
+                return juliet::with_precompiled_max_iterations<Index + 1>(max_iterations, std::forward<decltype(function)>(function));
+            }
+        }
+
+        return function.template operator ()<MaxIterations>();
+    }
+
+    /*
+        Returns how many iterations are worth spending on a frame
+        with the given pixel scale. Points take longer to escape the
+        nearer they are to the boundary, so deeper frames need more
+        to show any detail, while at the top level most would be wasted.
+    */
+    inline std::size_t auto_max_iterations(const juliet::floatexp pixel_scale, const juliet::resolution resolution) {
+        static constexpr auto BaseIterations = 200.0_scalar;
+
+        /* NOTE: A rule of thumb, doubling every ten doublings of zoom, i.e. about every thousandfold zoom. */
+        static constexpr auto ZoomDoublingsPerDoubling = 10.0_scalar;
+
+        const auto complete_pixel_scale = juliet::basic_frame<>::complete(resolution).pixel_scale;
+
+        const auto zoom_doublings = std::max(
+            std::log2(complete_pixel_scale) - log2(pixel_scale),
+
+            0.0_scalar
+        );
+
+        const auto max_iterations = std::min(
+            BaseIterations * std::exp2(zoom_doublings / ZoomDoublingsPerDoubling),
+
+            static_cast<juliet::scalar>(juliet::precompiled_max_iterations.back())
+        );
+
+        return static_cast<std::size_t>(max_iterations);
+    }
+
+    namespace test {
+
+        static_assert(juliet::with_precompiled_max_iterations(1uz, []<std::size_t MaxIterations>() { return MaxIterations; }) == 250uz);
+        static_assert(juliet::with_precompiled_max_iterations(500uz, []<std::size_t MaxIterations>() { return MaxIterations; }) == 500uz);
+        static_assert(juliet::with_precompiled_max_iterations(501uz, []<std::size_t MaxIterations>() { return MaxIterations; }) == 1'000uz);
+        static_assert(juliet::with_precompiled_max_iterations(1'000'000uz, []<std::size_t MaxIterations>() { return MaxIterations; }) == 100'000uz);
+
+    }
+
+    /*
+        The orbit of a pixel which hadn't escaped yet, so
+        that it can be continued to more iterations without
+        starting over. Its number comes from its coordinates.
+    */
+    template<typename Scalar = juliet::scalar>
+    struct pending_orbit {
+        juliet::coords              coords;
+        juliet::complex_for<Scalar> value;
+    };
+
+    /* The orbits of every pixel of a render which hadn't escaped, which have all been iterated the same amount. */
+    template<typename Scalar = juliet::scalar>
+    struct pending_orbits {
+        std::size_t iterations = 0;
+
+        std::vector<juliet::pending_orbit<Scalar>> orbits;
+    };
+
+    /* How the numbers of a render are iterated, when coloring by their iterations alone. */
+    enum class iteration_engine {
+        /* Interleaved for sets whose scalar can't be vectorized, and batched otherwise. */
+        automatic,
+
+        /* Batches of numbers in vectors, each batch iterated until all of its numbers are done. */
+        batched,
+
+        /*
+            Several independent scalar orbits at a time, each
+            replaced by the next number as soon as it's done.
+
+            NOTE: This is for processors whose vectors are too
+            narrow, or missing, for batches to pay off, e.g. some
+            ARM or older x86 processors.
+        */
+        interleaved,
+    };
+
+    namespace impl {
+
+        /*
+            Calls 'callback(nums, coords, num_filled)' for each batch
+            of the numbers in the region, in order, where 'num_filled'
+            is how many of the batch are actually from the region.
+
+            NOTE: This needs no renderer, so that regions can be
+            streamed through without any pixels to store them in.
+        */
+        template<typename Scalar>
+        constexpr void for_each_batch_in_region(
+            const juliet::basic_frame<Scalar> &frame,
+            const juliet::resolution resolution,
+
+            juliet::screen_region auto &&region,
+            const auto &callback
+        ) {
+            static constexpr auto Width = juliet::batch_width_for<Scalar>;
+
+            auto nums         = juliet::complex_batch<Width, Scalar>{};
+            auto batch_coords = std::array<juliet::coords, Width>{};
+
+            auto num_filled = 0uz;
+            for (const juliet::coords coords : std::forward<decltype(region)>(region)) {
+                batch_coords[num_filled] = coords;
+                nums.store(num_filled, frame.number_at_screen_coords(resolution, coords));
+
+                ++num_filled;
+                if (num_filled == Width) {
+                    callback(std::as_const(nums), std::as_const(batch_coords), num_filled);
+
+                    num_filled = 0;
+                }
+            }
+
+            if (num_filled > 0) {
+                /* NOTE: We pad out the last batch with a number we already need so the unused lanes escape no later than it. */
+                for (const auto i : std::views::iota(num_filled, Width)) {
+                    nums.store(i, nums[0]);
+                }
+
+                nums.num_filled = num_filled;
+
+                callback(std::as_const(nums), std::as_const(batch_coords), num_filled);
+            }
+        }
+
+    }
+
     struct frame_renderer_interface;
 
     namespace impl {
@@ -129,7 +497,7 @@ namespace juliet {
 
             requires(const Renderer &renderer) {
                 { renderer.resolution() } -> std::same_as<juliet::resolution>;
-                { renderer.frame() }      -> std::same_as<juliet::frame>;
+                { renderer.frame() }      -> juliet::frame_of_any_scalar;
             } &&
 
             requires(Renderer &renderer, const juliet::coords &coords) {
@@ -149,14 +517,68 @@ namespace juliet {
                     configure it without the implementer having to
                     account for that themselves.
 
-                    It could also be useful in the future if we
-                    implement different max iterations at different
-                    zoom levels, for example.
+                    Renderers which choose their max iterations at
+                    runtime are also asked for the colors of each of
+                    the 'precompiled_max_iterations'.
                 */
                 { renderer.template color_for_iterations<Renderer::max_iterations>(iterations) } -> std::same_as<typename Renderer::color>;
             }
         );
 
+        /* NOTE: Renderers whose colors are continuous, rather than in bands of whole iterations. */
+        template<typename Renderer>
+        concept smooth_frame_renderer = (
+            impl::iterative_frame_renderer<Renderer> &&
+
+            requires(const Renderer &renderer, const juliet::escape_result &escape) {
+                { renderer.template color_for_escape<Renderer::max_iterations>(escape) } -> std::same_as<typename Renderer::color>;
+            }
+        );
+
+        /* NOTE: Renderers which can color numbers by the root they converged to, for convergent sets. */
+        template<typename Renderer>
+        concept convergent_frame_renderer = (
+            impl::iterative_frame_renderer<Renderer> &&
+
+            requires(const Renderer &renderer, const juliet::convergence_result &convergence) {
+                { renderer.template color_for_convergence<Renderer::max_iterations>(convergence) } -> std::same_as<typename Renderer::color>;
+            }
+        );
+
+        /* NOTE: Renderers which can color numbers by the statistics an accumulator gathered from their orbits. */
+        template<typename Renderer>
+        concept accumulating_frame_renderer = (
+            impl::iterative_frame_renderer<Renderer> &&
+
+            requires(const Renderer &renderer, const juliet::accumulated_orbit<juliet::point_trap::num_outputs> &orbit) {
+                { renderer.template color_for_orbit<Renderer::max_iterations>(orbit, juliet::point_trap{}) } -> std::same_as<typename Renderer::color>;
+            }
+        );
+
+        /*
+            NOTE: Renderers which can color numbers by a Lyapunov
+            exponent, where the max iterations are instead how
+            many terms the exponent is averaged over.
+        */
+        template<typename Renderer>
+        concept lyapunov_frame_renderer = (
+            impl::frame_renderer<Renderer> &&
+
+            requires(const Renderer &renderer, const std::float32_t &exponent) {
+                { renderer.template color_for_exponent<Renderer::max_iterations>(exponent) } -> std::same_as<typename Renderer::color>;
+            }
+        );
+    }
+
+    namespace impl {
+
+        template<typename Renderer, typename Set>
+        concept renders_interleaved = juliet::interleaved_iterative_set<Set> && (
+            Renderer::engine == juliet::iteration_engine::interleaved ||
+
+            (Renderer::engine == juliet::iteration_engine::automatic && !simd::vectorizable<juliet::set_scalar<Set>>)
+        );
+
     }
 
     template<typename Renderer>
@@ -165,47 +587,443 @@ namespace juliet {
     template<typename Renderer>
     concept iterative_frame_renderer = impl::iterative_frame_renderer<std::remove_cvref_t<Renderer>>;
 
+    template<typename Renderer>
+    concept smooth_frame_renderer = impl::smooth_frame_renderer<std::remove_cvref_t<Renderer>>;
+
+    template<typename Renderer>
+    concept convergent_frame_renderer = impl::convergent_frame_renderer<std::remove_cvref_t<Renderer>>;
+
+    template<typename Renderer>
+    concept accumulating_frame_renderer = impl::accumulating_frame_renderer<std::remove_cvref_t<Renderer>>;
+
+    template<typename Renderer>
+    concept lyapunov_frame_renderer = impl::lyapunov_frame_renderer<std::remove_cvref_t<Renderer>>;
+
     struct frame_renderer_interface {
         static constexpr std::size_t max_iterations = 500;
 
+        /* NOTE: More-derived classes can pick a different engine, e.g. to compare them when benchmarking. */
+        static constexpr juliet::iteration_engine engine = juliet::iteration_engine::automatic;
+
+        /* NOTE: How many numbers the interleaved engine is handed at once, so that its lanes rarely sit idle at the end. */
+        static constexpr std::size_t interleaved_chunk_size = 256;
+
+        /*
+            Calls 'function.template operator ()<MaxIterations>()'
+            with the max iterations we should render with.
+
+            NOTE: Renderers can choose their max iterations at
+            runtime with a 'runtime_max_iterations' method, which
+            are then rounded up to the precompiled max iterations.
+        */
+        constexpr decltype(auto) with_max_iterations(this const juliet::frame_renderer auto &self, auto &&function) {
+            if constexpr (requires { { self.runtime_max_iterations() } -> std::same_as<std::size_t>; }) {
+                return juliet::with_precompiled_max_iterations(self.runtime_max_iterations(), std::forward<decltype(function)>(function));
+            } else {
+                return function.template operator ()<std::remove_cvref_t<decltype(self)>::max_iterations>();
+            }
+        }
+
+        /* NOTE: Sets should be prepared with these max iterations, as they're what we'll actually iterate up to. */
+        constexpr std::size_t rendered_max_iterations(this const juliet::frame_renderer auto &self) {
+            return self.with_max_iterations([]<std::size_t MaxIterations>() {
+                return MaxIterations;
+            });
+        }
+
         constexpr void render_by_iteration_at(
             this juliet::iterative_frame_renderer auto &self,
             const juliet::coords coords,
             const juliet::iterative_set auto &set
         ) {
-            static constexpr auto MaxIterations = std::remove_cvref_t<decltype(self)>::max_iterations;
+            self.with_max_iterations([&]<std::size_t MaxIterations>() {
+                using Scalar = juliet::set_scalar<decltype(set)>;
 
-            const auto frame      = std::as_const(self).frame();
-            const auto resolution = std::as_const(self).resolution();
+                const auto frame      = std::as_const(self).frame().template with_scalar<Scalar>();
+                const auto resolution = std::as_const(self).resolution();
+
+                const auto num = frame.number_at_screen_coords(resolution, coords);
 
-            const auto num = frame.number_at_screen_coords(resolution, coords);
+                /* NOTE: When rendering many pixels, prefer 'render_region_by_iteration' so this is done only once. */
+                const auto &frame_set = juliet::set_for_frame(set, frame, MaxIterations);
 
-            const auto iterations = set.template iterations_before_escape<MaxIterations>(num);
+                if constexpr (juliet::convergent_frame_renderer<decltype(self)> && juliet::convergent_set<decltype(frame_set)>) {
+                    const auto convergence = frame_set.template iterations_before_convergence<MaxIterations>(num);
 
-            self.set_pixel(coords, std::as_const(self).template color_for_iterations<MaxIterations>(iterations));
+                    self.set_pixel(coords, std::as_const(self).template color_for_convergence<MaxIterations>(convergence));
+                } else if constexpr (juliet::smooth_frame_renderer<decltype(self)> && juliet::smooth_iterative_set<decltype(frame_set)>) {
+                    const auto escape = frame_set.template smooth_iterations_before_escape<MaxIterations>(num);
+
+                    self.set_pixel(coords, std::as_const(self).template color_for_escape<MaxIterations>(escape));
+                } else {
+                    const auto iterations = frame_set.template iterations_before_escape<MaxIterations>(num);
+
+                    self.set_pixel(coords, std::as_const(self).template color_for_iterations<MaxIterations>(iterations));
+                }
+            });
         }
 
         constexpr void render_by_iteration(this juliet::iterative_frame_renderer auto &self, const juliet::iterative_set auto &set) {
             self.render_region_by_iteration(self.resolution().screen_coords(), set);
         }
 
+        /* NOTE: Like 'impl::for_each_batch_in_region', across our own frame and resolution. */
+        template<typename Scalar>
+        constexpr void _for_each_batch_in_region(
+            this const juliet::frame_renderer auto &self,
+            juliet::screen_region auto &&region,
+            const auto &callback
+        ) {
+            impl::for_each_batch_in_region(self.frame().template with_scalar<Scalar>(), self.resolution(), std::forward<decltype(region)>(region), callback);
+        }
+
+        /*
+            Calls 'callback(nums, coords)' with spans of up to 'ChunkSize'
+            of the numbers in the region at a time, in order.
+        */
+        template<typename Scalar, std::size_t ChunkSize>
+        constexpr void _for_each_chunk_in_region(
+            this const juliet::frame_renderer auto &self,
+            juliet::screen_region auto &&region,
+            const auto &callback
+        ) {
+            const auto frame      = self.frame().template with_scalar<Scalar>();
+            const auto resolution = self.resolution();
+
+            auto nums         = std::array<juliet::complex_for<Scalar>, ChunkSize>{};
+            auto chunk_coords = std::array<juliet::coords, ChunkSize>{};
+
+            auto num_filled = 0uz;
+            for (const juliet::coords coords : std::forward<decltype(region)>(region)) {
+                chunk_coords[num_filled] = coords;
+                nums[num_filled]         = frame.number_at_screen_coords(resolution, coords);
+
+                ++num_filled;
+                if (num_filled == ChunkSize) {
+                    callback(std::span<const juliet::complex_for<Scalar>>(nums), std::span<const juliet::coords>(chunk_coords));
+
+                    num_filled = 0;
+                }
+            }
+
+            if (num_filled > 0) {
+                callback(std::span<const juliet::complex_for<Scalar>>(nums).first(num_filled), std::span<const juliet::coords>(chunk_coords).first(num_filled));
+            }
+        }
+
         constexpr void render_region_by_iteration(
             this juliet::iterative_frame_renderer auto &self,
             juliet::screen_region auto &&region,
             const juliet::iterative_set auto &set
         ) {
-            static constexpr auto MaxIterations = std::remove_cvref_t<decltype(self)>::max_iterations;
+            self.with_max_iterations([&]<std::size_t MaxIterations>() {
+                using Scalar = juliet::set_scalar<decltype(set)>;
+                using Self   = std::remove_cvref_t<decltype(self)>;
 
-            const auto frame      = std::as_const(self).frame();
-            const auto resolution = std::as_const(self).resolution();
+                const auto &frame_set = juliet::set_for_frame(set, std::as_const(self).frame(), MaxIterations);
 
-            for (const juliet::coords coords : std::forward<decltype(region)>(region)) {
-                const auto num = frame.number_at_screen_coords(resolution, coords);
+                /* NOTE: The interleaved engine only gives escape counts, and so smoother colorings take precedence. */
+                if constexpr (
+                    impl::renders_interleaved<Self, std::remove_cvref_t<decltype(frame_set)>> &&
 
-                const auto iterations = set.template iterations_before_escape<MaxIterations>(num);
+                    !(juliet::convergent_frame_renderer<decltype(self)> && juliet::convergent_set<decltype(frame_set)>) &&
+                    !(juliet::smooth_frame_renderer<decltype(self)>     && juliet::smooth_iterative_set<decltype(frame_set)>)
+                ) {
+                    std::as_const(self).template _for_each_chunk_in_region<Scalar, Self::interleaved_chunk_size>(
+                        std::forward<decltype(region)>(region),
 
-                self.set_pixel(coords, std::as_const(self).template color_for_iterations<MaxIterations>(iterations));
-            }
+                        [&](const auto nums, const auto chunk_coords) {
+                            auto iterations = std::array<std::size_t, Self::interleaved_chunk_size>{};
+
+                            frame_set.template interleaved_iterations_before_escape<MaxIterations>(nums, std::span(iterations).first(nums.size()));
+
+                            for (const auto i : std::views::iota(0uz, nums.size())) {
+                                self.set_pixel(chunk_coords[i], std::as_const(self).template color_for_iterations<MaxIterations>(iterations[i]));
+                            }
+                        }
+                    );
+
+                    return;
+                }
+
+                std::as_const(self).template _for_each_batch_in_region<Scalar>(
+                    std::forward<decltype(region)>(region),
+
+                    [&](const auto &nums, const auto &batch_coords, const std::size_t num_filled) {
+                        /* NOTE: Sets can tell how their numbers escaped in the same pass, which is much cheaper than coloring afterwards. */
+                        if constexpr (juliet::convergent_frame_renderer<decltype(self)> && juliet::convergent_set<decltype(frame_set)>) {
+                            const auto convergences = juliet::batch_iterations_before_convergence<MaxIterations>(frame_set, nums);
+
+                            for (const auto i : std::views::iota(0uz, num_filled)) {
+                                self.set_pixel(batch_coords[i], std::as_const(self).template color_for_convergence<MaxIterations>(convergences[i]));
+                            }
+                        } else if constexpr (juliet::smooth_frame_renderer<decltype(self)> && juliet::smooth_iterative_set<decltype(frame_set)>) {
+                            const auto escapes = juliet::batch_smooth_iterations_before_escape<MaxIterations>(frame_set, nums);
+
+                            for (const auto i : std::views::iota(0uz, num_filled)) {
+                                self.set_pixel(batch_coords[i], std::as_const(self).template color_for_escape<MaxIterations>(escapes[i]));
+                            }
+                        } else {
+                            const auto iterations = juliet::batch_iterations_before_escape<MaxIterations>(frame_set, nums);
+
+                            for (const auto i : std::views::iota(0uz, num_filled)) {
+                                self.set_pixel(batch_coords[i], std::as_const(self).template color_for_iterations<MaxIterations>(iterations[i]));
+                            }
+                        }
+                    }
+                );
+            });
+        }
+
+        /*
+            Colors each pixel in the region by the statistics which
+            the accumulator gathers from its orbit, e.g. how close
+            it comes to an orbit trap.
+        */
+        constexpr void render_region_accumulating(
+            this juliet::accumulating_frame_renderer auto &self,
+            juliet::screen_region auto &&region,
+            const juliet::accumulating_set auto &set,
+            const juliet::orbit_accumulator auto &accumulator
+        ) {
+            self.with_max_iterations([&]<std::size_t MaxIterations>() {
+                using Scalar = juliet::set_scalar<decltype(set)>;
+
+                std::as_const(self).template _for_each_batch_in_region<Scalar>(
+                    std::forward<decltype(region)>(region),
+
+                    [&](const auto &nums, const auto &batch_coords, const std::size_t num_filled) {
+                        const auto orbits = juliet::batch_accumulate_orbits<MaxIterations>(set, nums, accumulator);
+
+                        for (const auto i : std::views::iota(0uz, num_filled)) {
+                            self.set_pixel(batch_coords[i], std::as_const(self).template color_for_orbit<MaxIterations>(orbits[i], accumulator));
+                        }
+                    }
+                );
+            });
+        }
+
+        constexpr void render_accumulating(
+            this juliet::accumulating_frame_renderer auto &self,
+            const juliet::accumulating_set auto &set,
+            const juliet::orbit_accumulator auto &accumulator
+        ) {
+            self.render_region_accumulating(self.resolution().screen_coords(), set, accumulator);
+        }
+
+        constexpr void render_region_lyapunov(
+            this juliet::lyapunov_frame_renderer auto &self,
+            juliet::screen_region auto &&region,
+            const juliet::lyapunov_fractal_like auto &fractal
+        ) {
+            self.with_max_iterations([&]<std::size_t NumTerms>() {
+                using Scalar = juliet::set_scalar<decltype(fractal)>;
+
+                std::as_const(self).template _for_each_batch_in_region<Scalar>(
+                    std::forward<decltype(region)>(region),
+
+                    [&](const auto &nums, const auto &batch_coords, const std::size_t num_filled) {
+                        const auto exponents = juliet::batch_exponents<NumTerms>(fractal, nums);
+
+                        for (const auto i : std::views::iota(0uz, num_filled)) {
+                            self.set_pixel(batch_coords[i], std::as_const(self).template color_for_exponent<NumTerms>(exponents[i]));
+                        }
+                    }
+                );
+            });
+        }
+
+        constexpr void render_lyapunov(this juliet::lyapunov_frame_renderer auto &self, const juliet::lyapunov_fractal_like auto &fractal) {
+            self.render_region_lyapunov(self.resolution().screen_coords(), fractal);
+        }
+
+        /*
+            Renders the pixels in the region of an atlas of the
+            members of the set's family, which should have the same
+            resolution as we do. Our own frame goes unused.
+
+            NOTE: Batches are filled in the order of the region no
+            matter which cells their pixels are in, so that cells need
+            no setup of their own and lanes aren't left empty at their
+            edges, which matters for atlases of small thumbnails.
+        */
+        constexpr void render_julia_atlas_region(
+            this juliet::iterative_frame_renderer auto &self,
+            juliet::screen_region auto &&region,
+            const juliet::julia_atlas &atlas,
+            const juliet::constant_family_set auto &set
+        ) {
+            self.with_max_iterations([&]<std::size_t MaxIterations>() {
+                using Scalar = juliet::set_scalar<decltype(set)>;
+
+                static constexpr auto Width = juliet::batch_width_for<Scalar>;
+
+                const auto thumbnail_frame = atlas.thumbnail_frame.template with_scalar<Scalar>();
+
+                const auto &frame_set = juliet::set_for_frame(set, atlas.thumbnail_frame, MaxIterations);
+
+                auto nums         = juliet::complex_batch<Width, Scalar>{};
+                auto constants    = juliet::complex_batch<Width, Scalar>{};
+                auto batch_coords = std::array<juliet::coords, Width>{};
+
+                const auto render_batch = [&](const std::size_t num_filled) {
+                    nums.num_filled      = num_filled;
+                    constants.num_filled = num_filled;
+
+                    const auto iterations = juliet::batch_iterations_before_escape<MaxIterations>(frame_set, std::as_const(nums), std::as_const(constants));
+
+                    for (const auto i : std::views::iota(0uz, num_filled)) {
+                        self.set_pixel(batch_coords[i], std::as_const(self).template color_for_iterations<MaxIterations>(iterations[i]));
+                    }
+                };
+
+                auto num_filled = 0uz;
+                for (const juliet::coords coords : std::forward<decltype(region)>(region)) {
+                    const auto cell             = atlas.cell_at_screen_coords(coords);
+                    const auto thumbnail_coords = atlas.thumbnail_coords_at_screen_coords(coords);
+
+                    batch_coords[num_filled] = coords;
+                    nums.store(num_filled, thumbnail_frame.number_at_screen_coords(atlas.thumbnail_resolution, thumbnail_coords));
+                    constants.store(num_filled, juliet::complex_cast<Scalar>(atlas.constant_for_cell(cell)));
+
+                    ++num_filled;
+                    if (num_filled == Width) {
+                        render_batch(num_filled);
+
+                        num_filled = 0;
+                    }
+                }
+
+                if (num_filled > 0) {
+                    /* NOTE: As in '_for_each_batch_in_region', we pad with a pixel we already need. */
+                    for (const auto i : std::views::iota(num_filled, Width)) {
+                        nums.store(i, nums[0]);
+                        constants.store(i, constants[0]);
+                    }
+
+                    render_batch(num_filled);
+                }
+            });
+        }
+
+        constexpr void render_julia_atlas(this juliet::iterative_frame_renderer auto &self, const juliet::julia_atlas &atlas, const juliet::constant_family_set auto &set) {
+            self.render_julia_atlas_region(self.resolution().screen_coords(), atlas, set);
+        }
+
+        /*
+            Like 'render_region_by_iteration', but also adds the
+            orbits of the pixels which haven't escaped to 'pending',
+            so that they can later be continued to more iterations.
+        */
+        template<typename PendingScalar>
+        constexpr void render_region_resumably(
+            this juliet::iterative_frame_renderer auto &self,
+            juliet::screen_region auto &&region,
+            const juliet::resumable_set auto &set,
+
+            std::vector<juliet::pending_orbit<PendingScalar>> &pending
+        ) {
+            self.with_max_iterations([&]<std::size_t MaxIterations>() {
+                using Scalar = juliet::set_scalar<decltype(set)>;
+
+                static constexpr auto Width = juliet::batch_width_for<Scalar>;
+
+                const auto &frame_set = juliet::set_for_frame(set, std::as_const(self).frame(), MaxIterations);
+
+                std::as_const(self).template _for_each_batch_in_region<Scalar>(
+                    std::forward<decltype(region)>(region),
+
+                    [&](const auto &nums, const auto &batch_coords, const std::size_t num_filled) {
+                        auto values = juliet::complex_batch<Width, Scalar>{};
+                        for (const auto i : std::views::iota(0uz, Width)) {
+                            values.store(i, frame_set.initial_orbit_value(nums[i]));
+                        }
+
+                        const auto iterations = juliet::batch_continue_orbits<MaxIterations>(frame_set, nums, values, 0uz);
+
+                        for (const auto i : std::views::iota(0uz, num_filled)) {
+                            self.set_pixel(batch_coords[i], std::as_const(self).template color_for_iterations<MaxIterations>(iterations[i]));
+
+                            if (iterations[i] == MaxIterations) {
+                                pending.push_back({batch_coords[i], juliet::complex_cast<PendingScalar>(values[i])});
+                            }
+                        }
+                    }
+                );
+            });
+        }
+
+        /*
+            Continues the orbits of pending pixels, which have all
+            been iterated 'first_iteration' times, up to our max
+            iterations, adding those which still haven't escaped
+            to 'still_pending'.
+
+            NOTE: Our frame must be the same as when the orbits
+            were first rendered. Pixels which had already escaped
+            keep the colors they were given for the old max
+            iterations, which may differ from what we'd give them.
+            Orbits whose coords no longer fit our resolution are
+            dropped rather than drawn out of bounds.
+        */
+        template<typename PendingScalar>
+        constexpr void continue_pending_by_iteration(
+            this juliet::iterative_frame_renderer auto &self,
+            const std::span<const juliet::pending_orbit<PendingScalar>> pending,
+            const std::size_t first_iteration,
+            const juliet::resumable_set auto &set,
+
+            std::vector<juliet::pending_orbit<PendingScalar>> &still_pending
+        ) {
+            self.with_max_iterations([&]<std::size_t MaxIterations>() {
+                using Scalar = juliet::set_scalar<decltype(set)>;
+
+                static constexpr auto Width = juliet::batch_width_for<Scalar>;
+
+                if (first_iteration >= MaxIterations) {
+                    still_pending.append_range(pending);
+
+                    return;
+                }
+
+                const auto &frame_set = juliet::set_for_frame(set, std::as_const(self).frame(), MaxIterations);
+
+                const auto resolution = std::as_const(self).resolution();
+
+                auto batch_start = 0uz;
+
+                std::as_const(self).template _for_each_batch_in_region<Scalar>(
+                    pending | std::views::transform(&juliet::pending_orbit<PendingScalar>::coords),
+
+                    [&](const auto &nums, const auto &batch_coords, const std::size_t num_filled) {
+                        /* NOTE: Padded lanes continue the first orbit, just as their numbers are the first number. */
+                        auto values = juliet::complex_batch<Width, Scalar>{};
+                        for (const auto i : std::views::iota(0uz, Width)) {
+                            const auto &orbit = pending[batch_start + (i < num_filled ? i : 0uz)];
+
+                            values.store(i, juliet::complex_cast<Scalar>(orbit.value));
+                        }
+
+                        const auto iterations = juliet::batch_continue_orbits<MaxIterations>(frame_set, nums, values, first_iteration);
+
+                        for (const auto i : std::views::iota(0uz, num_filled)) {
+                            if (!resolution.contains(batch_coords[i])) {
+                                continue;
+                            }
+
+                            if (iterations[i] == MaxIterations) {
+                                still_pending.push_back({batch_coords[i], juliet::complex_cast<PendingScalar>(values[i])});
+
+                                continue;
+                            }
+
+                            self.set_pixel(batch_coords[i], std::as_const(self).template color_for_iterations<MaxIterations>(iterations[i]));
+                        }
+
+                        batch_start += num_filled;
+                    }
+                );
+            });
         }
     };
 
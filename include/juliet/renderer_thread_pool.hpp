@@ -2,6 +2,9 @@
 
 #include <juliet/common.hpp>
 #include <juliet/render.hpp>
+#include <juliet/orbit_density.hpp>
+#include <juliet/julia_boundary.hpp>
+#include <juliet/reduction.hpp>
 
 namespace juliet {
 
@@ -20,34 +23,348 @@ namespace juliet {
 
             const auto resolution = renderer.resolution();
 
-            const auto width = resolution.width();
+            /* NOTE: We prepare the set for the frame once here so that each task doesn't have to. */
+            const auto &frame_set = juliet::set_for_frame(set, renderer.frame(), renderer.rendered_max_iterations());
+
             const auto pixels_per_thread = resolution.area() / (num_tasks + 1);
 
             for (const auto i : std::views::iota(0z, num_tasks)) {
                 const auto start_index = (i + 0) * pixels_per_thread;
                 const auto end_index   = (i + 1) * pixels_per_thread;
 
-                self._threads.detach_task([&renderer, &set, start_index, end_index, width]() {
-                    for (const auto index : std::views::iota(start_index, end_index)) {
-                        const auto coords = juliet::coords{
-                            index % width,
-                            index / width,
-                        };
+                self._threads.detach_task([&renderer, &frame_set, resolution, start_index, end_index]() {
+                    renderer.render_region_by_iteration(resolution.screen_coords_between(start_index, end_index), frame_set);
+                });
+            }
+
+            renderer.render_region_by_iteration(resolution.screen_coords_between(num_tasks * pixels_per_thread, resolution.area()), frame_set);
 
-                        renderer.render_by_iteration_at(coords, set);
-                    }
+            self._threads.wait();
+        }
+
+        /* NOTE: The pixels are split evenly between tasks regardless of cells, so that even atlases of tiny thumbnails keep every thread busy. */
+        void threaded_render_julia_atlas(
+            this renderer_thread_pool &self,
+            juliet::iterative_frame_renderer auto &renderer,
+            const juliet::julia_atlas &atlas,
+            const juliet::constant_family_set auto &set
+        ) {
+            const auto num_tasks = static_cast<juliet::coord>(self._threads.get_thread_count());
+
+            const auto resolution = renderer.resolution();
+
+            const auto &frame_set = juliet::set_for_frame(set, atlas.thumbnail_frame, renderer.rendered_max_iterations());
+
+            const auto pixels_per_thread = resolution.area() / (num_tasks + 1);
+
+            for (const auto i : std::views::iota(0z, num_tasks)) {
+                const auto start_index = (i + 0) * pixels_per_thread;
+                const auto end_index   = (i + 1) * pixels_per_thread;
+
+                self._threads.detach_task([&renderer, &atlas, &frame_set, resolution, start_index, end_index]() {
+                    renderer.render_julia_atlas_region(resolution.screen_coords_between(start_index, end_index), atlas, frame_set);
+                });
+            }
+
+            renderer.render_julia_atlas_region(resolution.screen_coords_between(num_tasks * pixels_per_thread, resolution.area()), atlas, frame_set);
+
+            self._threads.wait();
+        }
+
+        void threaded_render_accumulating(
+            this renderer_thread_pool &self,
+            juliet::accumulating_frame_renderer auto &renderer,
+            const juliet::accumulating_set auto &set,
+            const juliet::orbit_accumulator auto &accumulator
+        ) {
+            const auto num_tasks = static_cast<juliet::coord>(self._threads.get_thread_count());
+
+            const auto resolution = renderer.resolution();
+
+            const auto pixels_per_thread = resolution.area() / (num_tasks + 1);
+
+            for (const auto i : std::views::iota(0z, num_tasks)) {
+                const auto start_index = (i + 0) * pixels_per_thread;
+                const auto end_index   = (i + 1) * pixels_per_thread;
+
+                self._threads.detach_task([&renderer, &set, &accumulator, resolution, start_index, end_index]() {
+                    renderer.render_region_accumulating(resolution.screen_coords_between(start_index, end_index), set, accumulator);
+                });
+            }
+
+            renderer.render_region_accumulating(resolution.screen_coords_between(num_tasks * pixels_per_thread, resolution.area()), set, accumulator);
+
+            self._threads.wait();
+        }
+
+        void threaded_render_lyapunov(
+            this renderer_thread_pool &self,
+            juliet::lyapunov_frame_renderer auto &renderer,
+            const juliet::lyapunov_fractal_like auto &fractal
+        ) {
+            const auto num_tasks = static_cast<juliet::coord>(self._threads.get_thread_count());
+
+            const auto resolution = renderer.resolution();
+
+            const auto pixels_per_thread = resolution.area() / (num_tasks + 1);
+
+            for (const auto i : std::views::iota(0z, num_tasks)) {
+                const auto start_index = (i + 0) * pixels_per_thread;
+                const auto end_index   = (i + 1) * pixels_per_thread;
+
+                self._threads.detach_task([&renderer, &fractal, resolution, start_index, end_index]() {
+                    renderer.render_region_lyapunov(resolution.screen_coords_between(start_index, end_index), fractal);
                 });
             }
 
-            for (const auto index : std::views::iota(num_tasks * pixels_per_thread, resolution.area())) {
-                const auto coords = juliet::coords{
-                    index % width,
-                    index / width,
+            renderer.render_region_lyapunov(resolution.screen_coords_between(num_tasks * pixels_per_thread, resolution.area()), fractal);
+
+            self._threads.wait();
+        }
+
+        /*
+            Like 'threaded_render_by_iteration', but keeps the orbits of
+            the pixels which haven't escaped in 'pending', so that they
+            can later be continued with 'threaded_continue_pending'.
+        */
+        template<typename PendingScalar>
+        void threaded_render_resumably(
+            this renderer_thread_pool &self,
+            juliet::iterative_frame_renderer auto &renderer,
+            const juliet::resumable_set auto &set,
+
+            juliet::pending_orbits<PendingScalar> &pending
+        ) {
+            const auto num_tasks = static_cast<juliet::coord>(self._threads.get_thread_count());
+
+            const auto resolution = renderer.resolution();
+
+            const auto &frame_set = juliet::set_for_frame(set, renderer.frame(), renderer.rendered_max_iterations());
+
+            const auto pixels_per_thread = resolution.area() / (num_tasks + 1);
+
+            /* NOTE: Each task gets its own orbits so that they don't have to synchronize. */
+            auto task_orbits = std::vector<std::vector<juliet::pending_orbit<PendingScalar>>>(static_cast<std::size_t>(num_tasks + 1));
+
+            for (const auto i : std::views::iota(0z, num_tasks)) {
+                const auto start_index = (i + 0) * pixels_per_thread;
+                const auto end_index   = (i + 1) * pixels_per_thread;
+
+                self._threads.detach_task([&renderer, &frame_set, &orbits = task_orbits[static_cast<std::size_t>(i)], resolution, start_index, end_index]() {
+                    renderer.render_region_resumably(resolution.screen_coords_between(start_index, end_index), frame_set, orbits);
+                });
+            }
+
+            renderer.render_region_resumably(resolution.screen_coords_between(num_tasks * pixels_per_thread, resolution.area()), frame_set, task_orbits.back());
+
+            self._threads.wait();
+
+            pending.iterations = renderer.rendered_max_iterations();
+
+            pending.orbits.clear();
+            for (const auto &orbits : task_orbits) {
+                pending.orbits.append_range(orbits);
+            }
+        }
+
+        /*
+            Continues the pending orbits of a render up to the
+            renderer's max iterations, keeping only those which
+            still haven't escaped.
+
+            NOTE: The renderer's frame must not have changed since.
+        */
+        template<typename PendingScalar>
+        void threaded_continue_pending(
+            this renderer_thread_pool &self,
+            juliet::iterative_frame_renderer auto &renderer,
+            const juliet::resumable_set auto &set,
+
+            juliet::pending_orbits<PendingScalar> &pending
+        ) {
+            const auto num_tasks = self._threads.get_thread_count();
+
+            const auto &frame_set = juliet::set_for_frame(set, renderer.frame(), renderer.rendered_max_iterations());
+
+            const auto orbits = std::span<const juliet::pending_orbit<PendingScalar>>(pending.orbits);
+
+            const auto orbits_per_thread = orbits.size() / (num_tasks + 1);
+
+            auto task_orbits = std::vector<std::vector<juliet::pending_orbit<PendingScalar>>>(num_tasks + 1);
+
+            for (const auto i : std::views::iota(0uz, num_tasks)) {
+                self._threads.detach_task([&renderer, &frame_set, &pending, &still_pending = task_orbits[i], chunk = orbits.subspan(i * orbits_per_thread, orbits_per_thread)]() {
+                    renderer.continue_pending_by_iteration(chunk, pending.iterations, frame_set, still_pending);
+                });
+            }
+
+            renderer.continue_pending_by_iteration(orbits.subspan(num_tasks * orbits_per_thread), pending.iterations, frame_set, task_orbits.back());
+
+            self._threads.wait();
+
+            pending.iterations = std::max(pending.iterations, renderer.rendered_max_iterations());
+
+            pending.orbits.clear();
+            for (const auto &still_pending : task_orbits) {
+                pending.orbits.append_range(still_pending);
+            }
+        }
+
+        /*
+            Renders the density of the orbits of 'num_samples' numbers,
+            e.g. for the Buddhabrot, spreading the samples across threads.
+
+            NOTE: Each task accumulates into its own histogram, so
+            that they never contend over the pixels they hit, and the
+            histograms are then summed together in parallel, with
+            each task summing a separate range of the pixels.
+        */
+        template<std::size_t NumBands>
+        void threaded_render_orbit_density(
+            this renderer_thread_pool &self,
+            juliet::orbit_density_renderer<NumBands> &renderer,
+            const juliet::orbit_tracing_set auto &set,
+
+            const std::size_t num_samples,
+            const std::uint64_t seed
+        ) {
+            const auto num_tasks = self._threads.get_thread_count();
+
+            auto &histogram = renderer.histogram();
+            histogram.clear();
+
+            /* NOTE: The last task accumulates straight into the renderer's histogram. */
+            auto task_histograms = std::vector<juliet::orbit_histogram<NumBands>>(num_tasks, juliet::orbit_histogram<NumBands>(renderer.resolution()));
+
+            const auto samples_per_thread = num_samples / (num_tasks + 1);
+
+            for (const auto i : std::views::iota(0uz, num_tasks)) {
+                self._threads.detach_task([&renderer, &set, &task_histogram = task_histograms[i], num_samples, samples_per_thread, i, seed]() {
+                    renderer.accumulate_samples(set, task_histogram, num_samples, i * samples_per_thread, (i + 1) * samples_per_thread, seed);
+                });
+            }
+
+            renderer.accumulate_samples(set, histogram, num_samples, num_tasks * samples_per_thread, num_samples, seed);
+
+            self._threads.wait();
+
+            const auto area = static_cast<std::size_t>(renderer.resolution().area());
+
+            const auto pixels_per_thread = area / (num_tasks + 1);
+
+            const auto merge_range = [&histogram, &task_histograms](const std::size_t start_index, const std::size_t end_index) {
+                for (const auto &task_histogram : task_histograms) {
+                    histogram.merge_range(task_histogram, start_index, end_index);
+                }
+            };
+
+            for (const auto i : std::views::iota(0uz, num_tasks)) {
+                self._threads.detach_task([&merge_range, pixels_per_thread, i]() {
+                    merge_range(i * pixels_per_thread, (i + 1) * pixels_per_thread);
+                });
+            }
+
+            merge_range(num_tasks * pixels_per_thread, area);
+
+            self._threads.wait();
+        }
+
+        /*
+            Reduces every number of the grid, returning the reducer
+            with all of them merged into it. Each task reduces into
+            its own empty copy, so that however large the grid is, no
+            more memory is needed than a reducer for each thread.
+
+            NOTE: The grid is dealt out to the tasks in interleaved
+            chunks rather than one range each, so that the tasks
+            which land on the interior, which is far slower to
+            iterate, don't hold up the rest. As with renderers, the
+            max iterations are rounded up to the precompiled ones.
+        */
+        template<juliet::iteration_reducer Reducer>
+        Reducer threaded_reduce(
+            this renderer_thread_pool &self,
+            const juliet::iterative_set auto &set,
+            const juliet::sample_grid &grid,
+            const std::size_t max_iterations,
+            Reducer reducer
+        ) {
+            /* NOTE: Large enough that handing out chunks costs next to nothing, and small enough to spread the interior evenly. */
+            static constexpr auto ChunkSize = juliet::coord{1} << 16;
+
+            const auto num_tasks = self._threads.get_thread_count();
+
+            const auto area       = grid.resolution.area();
+            const auto num_chunks = static_cast<std::size_t>((area + ChunkSize - 1) / ChunkSize);
+
+            juliet::with_precompiled_max_iterations(max_iterations, [&]<std::size_t MaxIterations>() {
+                const auto &frame_set = juliet::set_for_frame(set, grid.frame, MaxIterations);
+
+                const auto reduce_chunks = [&frame_set, &grid, area, num_chunks, num_tasks](const std::size_t task, Reducer &task_reducer) {
+                    for (auto chunk = task; chunk < num_chunks; chunk += num_tasks + 1) {
+                        const auto start_index = static_cast<juliet::coord>(chunk) * ChunkSize;
+                        const auto end_index   = std::min(start_index + ChunkSize, area);
+
+                        impl::reduce_region_for_frame<MaxIterations>(frame_set, grid, grid.resolution.screen_coords_between(start_index, end_index), task_reducer);
+                    }
                 };
 
-                renderer.render_by_iteration_at(coords, set);
+                /* NOTE: The last task reduces into its own copy too, so that whatever the reducer already held is only counted once. */
+                auto task_reducers = std::vector<Reducer>(num_tasks + 1, reducer.empty_copy());
+
+                for (const auto i : std::views::iota(0uz, num_tasks)) {
+                    self._threads.detach_task([&reduce_chunks, &task_reducer = task_reducers[i], i]() {
+                        reduce_chunks(i, task_reducer);
+                    });
+                }
+
+                reduce_chunks(num_tasks, task_reducers.back());
+
+                self._threads.wait();
+
+                for (const auto &task_reducer : task_reducers) {
+                    reducer.merge(task_reducer);
+                }
+            });
+
+            return reducer;
+        }
+
+        /*
+            NOTE: Each task traces from its own share of the starting
+            points, but they all trace into the same bitmaps, so that
+            each prunes against what every other has already drawn.
+        */
+        template<typename Periodicity, typename Scalar>
+        void threaded_render_julia_boundary(
+            this renderer_thread_pool &self,
+            juliet::julia_boundary_renderer &renderer,
+            const juliet::basic_quadratic_julia_set<Periodicity, Scalar> &set
+        ) {
+            /* NOTE: More starting points than tasks, so that no one task is stuck with most of the boundary. */
+            static constexpr auto PointsPerTask = 8uz;
+
+            const auto num_tasks = self._threads.get_thread_count();
+
+            auto &boundary = renderer.boundary();
+            boundary.clear();
+
+            const auto points = renderer.starting_points(set, PointsPerTask * (num_tasks + 1));
+
+            auto overview = juliet::pixel_bitmap(renderer.overview_resolution());
+
+            const auto points_per_thread = points.size() / (num_tasks + 1);
+
+            for (const auto i : std::views::iota(0uz, num_tasks)) {
+                const auto task_points = std::span(points).subspan(i * points_per_thread, points_per_thread);
+
+                self._threads.detach_task([&renderer, &set, &boundary, &overview, task_points]() {
+                    renderer.trace_boundary(set, task_points, boundary, overview);
+                });
             }
 
+            renderer.trace_boundary(set, std::span(points).subspan(num_tasks * points_per_thread), boundary, overview);
+
             self._threads.wait();
         }
 
@@ -59,22 +376,20 @@ namespace juliet {
         ) {
             const auto num_tasks = self._threads.get_thread_count();
 
+            const auto &frame_set = juliet::set_for_frame(set, renderer.frame(), renderer.rendered_max_iterations());
+
             const auto pixels_per_thread = std::ranges::size(region) / (num_tasks + 1);
 
             auto it = std::ranges::begin(region);
             for (auto _ : std::views::iota(0uz, num_tasks)) {
-                self._threads.detach_task([&renderer, &set, it, pixels_per_thread] {
-                    for (const juliet::coords coords : std::views::counted(it, pixels_per_thread)) {
-                        renderer.render_by_iteration_at(coords, set);
-                    }
+                self._threads.detach_task([&renderer, &frame_set, it, pixels_per_thread] {
+                    renderer.render_region_by_iteration(std::views::counted(it, pixels_per_thread), frame_set);
                 });
 
                 std::ranges::advance(it, pixels_per_thread);
             }
 
-            for (const juliet::coords coords : std::ranges::subrange(it, std::ranges::end(region))) {
-                renderer.render_by_iteration_at(coords, set);
-            }
+            renderer.render_region_by_iteration(std::views::counted(it, std::ranges::size(region) - num_tasks * pixels_per_thread), frame_set);
 
             self._threads.wait();
         }
@@ -95,6 +410,9 @@ namespace juliet {
                 return;
             }
 
+            /* NOTE: We prepare the set once for all the edges we render. */
+            const auto &frame_set = juliet::set_for_frame(set, renderer.frame(), renderer.rendered_max_iterations());
+
             /* NOTE: Could probably deduplicate code here but don't know that it'd be worth it. */
 
             if (offset_x > 0) {
@@ -106,7 +424,7 @@ namespace juliet {
                         {offset_x, resolution.height()}
                     ),
 
-                    set
+                    frame_set
                 );
 
                 if (offset_y > 0) {
@@ -118,7 +436,7 @@ namespace juliet {
                             {resolution.width(), offset_y}
                         ),
 
-                        set
+                        frame_set
                     );
                 } else if (offset_y < 0) {
                     self.threaded_render_region_by_iteration(
@@ -129,7 +447,7 @@ namespace juliet {
                             {resolution.width(), resolution.height()}
                         ),
 
-                        set
+                        frame_set
                     );
                 }
             } else if (offset_x < 0) {
@@ -141,7 +459,7 @@ namespace juliet {
                         {resolution.width(),            resolution.height()}
                     ),
 
-                    set
+                    frame_set
                 );
 
                 if (offset_y > 0) {
@@ -153,7 +471,7 @@ namespace juliet {
                             {resolution.width() + offset_x, offset_y}
                         ),
 
-                        set
+                        frame_set
                     );
                 } else if (offset_y < 0) {
                     self.threaded_render_region_by_iteration(
@@ -164,7 +482,7 @@ namespace juliet {
                             {resolution.width() + offset_x, resolution.height()}
                         ),
 
-                        set
+                        frame_set
                     );
                 }
             } else {
@@ -177,7 +495,7 @@ namespace juliet {
                             {resolution.width(), offset_y}
                         ),
 
-                        set
+                        frame_set
                     );
                 } else if (offset_y < 0) {
                     self.threaded_render_region_by_iteration(
@@ -188,7 +506,7 @@ namespace juliet {
                             {resolution.width(), resolution.height()}
                         ),
 
-                        set
+                        frame_set
                     );
                 }
             }
@@ -35,25 +35,55 @@ namespace juliet {
         };
     }
 
+    /* NOTE: Numbers which took longer than this to converge are all shaded the darkest. */
+    constexpr inline std::size_t max_shaded_convergence_iterations = 32;
+
+    /*
+        Colors a number by the root it converged to, darker the
+        longer it took. The roots are spaced apart in hue by the
+        golden angle, so that any number of them stay distinct.
+    */
+    constexpr color::lch lch_color_for_convergence(const std::size_t root, const std::size_t iterations) {
+        static constexpr std::float32_t GoldenAngle = 137.50776f32;
+
+        const auto darkness = (
+            static_cast<std::float32_t>(std::min(iterations, juliet::max_shaded_convergence_iterations)) /
+
+            static_cast<std::float32_t>(juliet::max_shaded_convergence_iterations)
+        );
+
+        return color::lch{
+            80.0f32 - 60.0f32 * darkness,
+
+            45.0f32,
+
+            std::fmod(GoldenAngle * static_cast<std::float32_t>(root), 360.0f32)
+        };
+    }
+
     namespace impl {
-        template<typename Color>
+        template<typename Color, typename Scalar = juliet::scalar, bool Smooth = false>
         requires (std::same_as<Color, color::rgb> || std::same_as<Color, color::rgba>)
         struct rgb_based_renderer: juliet::frame_renderer_interface {
             static constexpr bool HasAlpha = std::same_as<Color, color::rgba>;
 
-            using color = Color;
+            using color      = Color;
+            using scalar     = Scalar;
+            using frame_type = juliet::basic_frame<Scalar>;
 
             juliet::resolution _resolution;
-            juliet::frame      _frame;
+            frame_type         _frame;
+
+            std::size_t _max_iterations = juliet::frame_renderer_interface::max_iterations;
 
             std::vector<color> _pixels;
 
             constexpr explicit rgb_based_renderer(const juliet::resolution resolution)
             :
-                rgb_based_renderer(resolution, juliet::frame::complete(resolution))
+                rgb_based_renderer(resolution, frame_type::complete(resolution))
             {}
 
-            constexpr rgb_based_renderer(const juliet::resolution resolution, const juliet::frame &frame)
+            constexpr rgb_based_renderer(const juliet::resolution resolution, const frame_type &frame)
             :
                 _resolution(resolution),
                 _frame(frame),
@@ -74,18 +104,31 @@ namespace juliet {
                 self._pixels.resize(resolution.area());
             }
 
-            constexpr juliet::frame frame(this const rgb_based_renderer &self) {
+            constexpr frame_type frame(this const rgb_based_renderer &self) {
                 return self._frame;
             }
 
+            constexpr std::size_t runtime_max_iterations(this const rgb_based_renderer &self) {
+                return self._max_iterations;
+            }
+
+            /* NOTE: These get rounded up to the nearest of the 'precompiled_max_iterations'. */
+            constexpr void set_max_iterations(this rgb_based_renderer &self, const std::size_t max_iterations) {
+                self._max_iterations = max_iterations;
+            }
+
             constexpr void set_complete_frame(this rgb_based_renderer &self) {
-                self._frame = juliet::frame::complete(self._resolution);
+                self._frame = frame_type::complete(self._resolution);
+            }
+
+            constexpr void set_frame(this rgb_based_renderer &self, const frame_type &frame) {
+                self._frame = frame;
             }
 
             constexpr void translate_frame_by_coords(this rgb_based_renderer &self, const juliet::coord offset_x, const juliet::coord offset_y) {
-                self._frame.center += self._frame.pixel_scale * juliet::complex{
-                    static_cast<juliet::scalar>(offset_x),
-                    static_cast<juliet::scalar>(offset_y)
+                self._frame.center += self._frame.pixel_scale * juliet::complex_for<Scalar>{
+                    static_cast<Scalar>(offset_x),
+                    static_cast<Scalar>(offset_y)
                 };
             }
 
@@ -131,11 +174,11 @@ namespace juliet {
             }
 
             constexpr void scale_pixel_width(this rgb_based_renderer &self, const juliet::scalar amount) {
-                self._frame.pixel_scale *= amount;
+                self._frame.pixel_scale *= static_cast<Scalar>(amount);
             }
 
             constexpr void unscale_pixel_width(this rgb_based_renderer &self, const juliet::scalar amount) {
-                self._frame.pixel_scale /= amount;
+                self._frame.pixel_scale /= static_cast<Scalar>(amount);
             }
 
             constexpr color get_pixel(this const rgb_based_renderer &self, const juliet::coords coords) {
@@ -148,7 +191,10 @@ namespace juliet {
 
             template<std::size_t MaxIterations>
             static constexpr color color_for_iterations(const std::size_t iterations) {
-                static constexpr auto Colors = []() {
+                /* NOTE: Past this many colors, computing them at compile time takes longer than it's worth. */
+                static constexpr auto MaxPrecomputedIterations = 5'000uz;
+
+                static constexpr auto MakeColors = []() {
                     std::array<color, MaxIterations + 1> colors;
 
                     for (const auto iterations : std::views::iota(0uz, colors.size())) {
@@ -160,9 +206,165 @@ namespace juliet {
                     }
 
                     return colors;
+                };
+
+                if constexpr (MaxIterations <= MaxPrecomputedIterations) {
+                    static constexpr auto Colors = MakeColors();
+
+                    return Colors[iterations];
+                } else {
+                    /* NOTE: Computed the first time they're needed instead. */
+                    static const auto Colors = MakeColors();
+
+                    return Colors[iterations];
+                }
+            }
+
+            template<std::size_t MaxIterations>
+            static constexpr color color_for_convergence(const juliet::convergence_result &convergence) {
+                /* NOTE: Past this many roots, their colors repeat. */
+                static constexpr auto NumRootColors = 16uz;
+
+                /* NOTE: Numbers which didn't converge to a root are colored like they would be for escaping. */
+                if (convergence.root == juliet::convergence_result::no_root) {
+                    return rgb_based_renderer::color_for_iterations<MaxIterations>(convergence.iterations);
+                }
+
+                static constexpr auto Colors = []() {
+                    std::array<std::array<color, juliet::max_shaded_convergence_iterations + 1>, NumRootColors> colors;
+
+                    for (const auto root : std::views::iota(0uz, colors.size())) {
+                        for (const auto iterations : std::views::iota(0uz, colors[root].size())) {
+                            if constexpr (HasAlpha) {
+                                colors[root][iterations] = juliet::lch_color_for_convergence(root, iterations).rgb().rgba();
+                            } else {
+                                colors[root][iterations] = juliet::lch_color_for_convergence(root, iterations).rgb();
+                            }
+                        }
+                    }
+
+                    return colors;
+                }();
+
+                return Colors[convergence.root % NumRootColors][std::min(convergence.iterations, juliet::max_shaded_convergence_iterations)];
+            }
+
+            /*
+                NOTE: We blend between the colors of the iterations
+                on either side, which looks the same as computing
+                the color exactly but is far cheaper.
+            */
+            template<std::size_t MaxIterations>
+            static constexpr color color_for_escape(const juliet::escape_result &escape) requires (Smooth) {
+                const auto from = rgb_based_renderer::color_for_iterations<MaxIterations>(escape.iterations);
+
+                if (escape.iterations >= MaxIterations) {
+                    return from;
+                }
+
+                /* NOTE: The color for the max iterations is for numbers that don't escape, so we don't blend towards it. */
+                const auto to = rgb_based_renderer::color_for_iterations<MaxIterations>(std::min(escape.iterations + 1, MaxIterations - 1));
+
+                const auto fraction = std::clamp(
+                    static_cast<std::float32_t>(escape.smooth_iterations - static_cast<juliet::scalar>(escape.iterations)),
+
+                    0.0f32, 1.0f32
+                );
+
+                const auto blend = [&](const std::uint8_t from_channel, const std::uint8_t to_channel) {
+                    return static_cast<std::uint8_t>(
+                        static_cast<std::float32_t>(from_channel) +
+
+                        fraction * (static_cast<std::float32_t>(to_channel) - static_cast<std::float32_t>(from_channel))
+                    );
+                };
+
+                if constexpr (HasAlpha) {
+                    return {
+                        blend(from.red,   to.red),
+                        blend(from.green, to.green),
+                        blend(from.blue,  to.blue),
+
+                        from.alpha
+                    };
+                } else {
+                    return {
+                        blend(from.red,   to.red),
+                        blend(from.green, to.green),
+                        blend(from.blue,  to.blue)
+                    };
+                }
+            }
+
+            /*
+                NOTE: Numbers which escape keep the colors of their
+                iterations, darkened by the accumulator's shade,
+                while those which don't are shaded in gray, as
+                their orbits are usually what's being shown.
+            */
+            template<std::size_t MaxIterations, std::size_t NumOutputs>
+            static constexpr color color_for_orbit(const juliet::accumulated_orbit<NumOutputs> &orbit, const juliet::orbit_accumulator auto &accumulator) {
+                const auto shade = std::clamp(accumulator.shade(orbit.outputs), 0.0f32, 1.0f32);
+
+                const auto darken = [&](const std::uint8_t channel) {
+                    return static_cast<std::uint8_t>(shade * static_cast<std::float32_t>(channel));
+                };
+
+                const auto from = [&]() -> color {
+                    if (orbit.iterations < MaxIterations) {
+                        return rgb_based_renderer::color_for_iterations<MaxIterations>(orbit.iterations);
+                    }
+
+                    return color::gray(255);
+                }();
+
+                if constexpr (HasAlpha) {
+                    return {
+                        darken(from.red),
+                        darken(from.green),
+                        darken(from.blue),
+
+                        from.alpha
+                    };
+                } else {
+                    return {
+                        darken(from.red),
+                        darken(from.green),
+                        darken(from.blue)
+                    };
+                }
+            }
+
+            /*
+                NOTE: Stable numbers, with negative exponents, are
+                shaded yellow, brighter the more stable they are,
+                while chaotic ones fade from blue into black. Orbits
+                which blew up have no exponent and are left black.
+            */
+            template<std::size_t NumTerms>
+            static constexpr color color_for_exponent(const std::float32_t exponent) {
+                const auto [fraction, red, green, blue] = [&]() -> std::array<std::float32_t, 4> {
+                    if (exponent < 0.0f32) {
+                        return {std::min(-exponent, 1.0f32), 255.0f32, 220.0f32, 40.0f32};
+                    }
+
+                    /* NOTE: This is also false for NaN. */
+                    if (exponent <= 1.0f32) {
+                        return {1.0f32 - exponent, 20.0f32, 40.0f32, 160.0f32};
+                    }
+
+                    return {};
                 }();
 
-                return Colors[iterations];
+                const auto shade = [&](const std::float32_t channel) {
+                    return static_cast<std::uint8_t>(fraction * channel);
+                };
+
+                if constexpr (HasAlpha) {
+                    return {shade(red), shade(green), shade(blue), 0xFF};
+                } else {
+                    return {shade(red), shade(green), shade(blue)};
+                }
             }
 
             void save_png(this const rgb_based_renderer &self, const char *path) {
@@ -190,10 +392,38 @@ namespace juliet {
         };
     }
 
-    using rgb_renderer  = impl::rgb_based_renderer<color::rgb>;
-    using rgba_renderer = impl::rgb_based_renderer<color::rgba>;
+    /* NOTE: The scalar is the precision the frame is held in, which may be more than the sets rendered in it need. */
+    template<typename Scalar>
+    using basic_rgb_renderer = impl::rgb_based_renderer<color::rgb, Scalar>;
+
+    template<typename Scalar>
+    using basic_rgba_renderer = impl::rgb_based_renderer<color::rgba, Scalar>;
+
+    using rgb_renderer  = juliet::basic_rgb_renderer<juliet::scalar>;
+    using rgba_renderer = juliet::basic_rgba_renderer<juliet::scalar>;
+
+    /* NOTE: These color continuously with sets which can tell how their numbers escaped, instead of in bands. */
+    template<typename Scalar>
+    using basic_smooth_rgb_renderer = impl::rgb_based_renderer<color::rgb, Scalar, true>;
+
+    template<typename Scalar>
+    using basic_smooth_rgba_renderer = impl::rgb_based_renderer<color::rgba, Scalar, true>;
+
+    using smooth_rgb_renderer  = juliet::basic_smooth_rgb_renderer<juliet::scalar>;
+    using smooth_rgba_renderer = juliet::basic_smooth_rgba_renderer<juliet::scalar>;
 
     static_assert(juliet::iterative_frame_renderer<juliet::rgb_renderer>);
     static_assert(juliet::iterative_frame_renderer<juliet::rgba_renderer>);
+    static_assert(juliet::iterative_frame_renderer<juliet::basic_rgba_renderer<juliet::quad_double>>);
+
+    static_assert(!juliet::smooth_frame_renderer<juliet::rgba_renderer>);
+    static_assert(juliet::smooth_frame_renderer<juliet::smooth_rgb_renderer>);
+    static_assert(juliet::smooth_frame_renderer<juliet::smooth_rgba_renderer>);
+
+    static_assert(juliet::convergent_frame_renderer<juliet::rgb_renderer>);
+    static_assert(juliet::convergent_frame_renderer<juliet::rgba_renderer>);
+
+    static_assert(juliet::lyapunov_frame_renderer<juliet::rgb_renderer>);
+    static_assert(juliet::lyapunov_frame_renderer<juliet::rgba_renderer>);
 
 }
@@ -1,70 +1,3989 @@
 #pragma once
 
 #include <juliet/common.hpp>
+#include <juliet/simd.hpp>
+#include <juliet/multi_double.hpp>
+#include <juliet/fixed_point.hpp>
 
 namespace juliet {
 
+    namespace impl {
+
+        template<typename Set>
+        struct set_scalar {
+            using type = juliet::scalar;
+        };
+
+        template<typename Set>
+        requires (requires { typename Set::scalar; })
+        struct set_scalar<Set> {
+            using type = typename Set::scalar;
+        };
+
+    }
+
+    /* NOTE: Sets which don't say otherwise are iterated with our default scalar. */
+    template<typename Set>
+    using set_scalar = typename impl::set_scalar<std::remove_cvref_t<Set>>::type;
+
+    template<typename To, typename From>
+    constexpr juliet::complex_for<To> complex_cast(const juliet::complex_for<From> &num) {
+        return {static_cast<To>(num.real()), static_cast<To>(num.imag())};
+    }
+
+    /* NOTE: Unlike 'std::norm', this doesn't need a square root of the scalar, which not all of ours have. */
+    template<typename Scalar>
+    constexpr juliet::scalar magnitude_sq(const juliet::complex_for<Scalar> &num) {
+        return static_cast<juliet::scalar>(num.real() * num.real() + num.imag() * num.imag());
+    }
+
+    namespace impl {
+
+        template<typename Scalar>
+        constexpr inline int scalar_digits = []() -> int {
+            if constexpr (std::floating_point<Scalar>) {
+                return std::numeric_limits<Scalar>::digits;
+            } else {
+                return static_cast<int>(Scalar::digits);
+            }
+        }();
+
+    }
+
     template<typename Set>
-    concept iterative_set = std::movable<std::remove_cvref_t<Set>> && requires(const Set &set, const juliet::complex num) {
+    concept iterative_set = std::movable<std::remove_cvref_t<Set>> && requires(const Set &set, const juliet::complex_for<juliet::set_scalar<Set>> num) {
         { set.template iterations_before_escape<0uz>(num) } -> std::same_as<std::size_t>;
     };
 
-    struct mandelbrot_set_t {
-        template<std::size_t MaxIterations>
-        static constexpr std::size_t iterations_before_escape(const juliet::complex num) {
-            static constexpr auto EscapeMagnitudeSquared = 2.0_scalar * 2.0_scalar;
+    /*
+        NOTE: The number of points renderers hand to a set at once.
 
-            auto z = juliet::complex{};
+        This is the width of our widest instruction set so that
+        every flavor of our kernels has a full batch to work on,
+        which for narrower scalars means more points at once.
+    */
+    template<typename Scalar>
+    constexpr inline std::size_t batch_width_for = []() {
+        if constexpr (simd::vectorizable<Scalar>) {
+            return simd::width<simd::widest_isa, Scalar>;
+        } else {
+            return simd::width<simd::widest_isa, juliet::scalar>;
+        }
+    }();
 
-            juliet::scalar real_sq = 0;
-            juliet::scalar imag_sq = 0;
+    constexpr inline std::size_t batch_width = juliet::batch_width_for<juliet::scalar>;
 
-            for (const auto i : std::views::iota(0uz, MaxIterations)) {
-                z.imag(2.0_scalar * z.real() * z.imag() + num.imag());
-                z.real(real_sq - imag_sq + num.real());
+    /* A structure-of-arrays batch of complex numbers, so that they can be loaded straight into vector registers. */
+    template<std::size_t Width, typename Scalar = juliet::scalar>
+    struct complex_batch {
+        std::array<Scalar, Width> real = {};
+        std::array<Scalar, Width> imag = {};
 
-                real_sq = z.real() * z.real();
-                imag_sq = z.imag() * z.imag();
+        /* NOTE: Lanes past this only pad out the batch, repeating numbers before them, and so are left out of statistics. */
+        std::size_t num_filled = Width;
 
-                if (real_sq + imag_sq > EscapeMagnitudeSquared) {
-                    return i;
+        constexpr juliet::complex_for<Scalar> operator [](this const complex_batch &self, const std::size_t index) {
+            return {self.real[index], self.imag[index]};
+        }
+
+        constexpr void store(this complex_batch &self, const std::size_t index, const juliet::complex_for<Scalar> &num) {
+            self.real[index] = num.real();
+            self.imag[index] = num.imag();
+        }
+    };
+
+    template<std::size_t Width>
+    using iterations_batch = std::array<std::size_t, Width>;
+
+    /* How a number escaped, for coloring which is continuous instead of in bands of whole iterations. */
+    struct escape_result {
+        std::size_t iterations;
+
+        /* NOTE: Of the orbit's value once it escaped, or zero if it didn't. */
+        juliet::scalar magnitude_sq;
+
+        /* NOTE: The iterations plus a fraction which makes them continuous from one iteration to the next. */
+        juliet::scalar smooth_iterations;
+
+        static constexpr escape_result from_orbit(const std::size_t iterations, const std::size_t max_iterations, const juliet::scalar magnitude_sq) {
+            if (iterations >= max_iterations) {
+                return {iterations, 0.0_scalar, static_cast<juliet::scalar>(iterations)};
+            }
+
+            /*
+                NOTE: See https://en.wikipedia.org/wiki/Plotting_algorithms_for_the_Mandelbrot_set#Continuous_(smooth)_coloring
+
+                With our escape radius of 2 the fraction is always less
+                than 1, and is only below 0 when the orbit's constant
+                is large enough to throw it well past escaping.
+            */
+            const auto fraction = 1.0_scalar - std::log2(std::log2(magnitude_sq) / 2.0_scalar);
+
+            return {iterations, magnitude_sq, static_cast<juliet::scalar>(iterations) + fraction};
+        }
+
+        friend constexpr bool operator ==(const escape_result &lhs, const escape_result &rhs) = default;
+    };
+
+    template<std::size_t Width>
+    using escapes_batch = std::array<juliet::escape_result, Width>;
+
+    /* Sets which can also tell how their numbers escaped, in the same pass as counting their iterations. */
+    template<typename Set>
+    concept smooth_iterative_set = juliet::iterative_set<Set> && requires(const Set &set, const juliet::complex_for<juliet::set_scalar<Set>> num) {
+        { set.template smooth_iterations_before_escape<0uz>(num) } -> std::same_as<juliet::escape_result>;
+    };
+
+    template<typename Set, std::size_t Width>
+    concept batch_iterative_set = juliet::iterative_set<Set> && requires(const Set &set, const juliet::complex_batch<Width, juliet::set_scalar<Set>> &nums) {
+        { set.template iterations_before_escape<0uz>(nums) } -> std::same_as<juliet::iterations_batch<Width>>;
+    };
+
+    template<std::size_t MaxIterations, std::size_t Width, typename Scalar>
+    constexpr juliet::iterations_batch<Width> batch_iterations_before_escape(const juliet::iterative_set auto &set, const juliet::complex_batch<Width, Scalar> &nums) {
+        if constexpr (juliet::batch_iterative_set<decltype(set), Width>) {
+            return set.template iterations_before_escape<MaxIterations>(nums);
+        } else {
+            /* NOTE: Sets which only know how to handle one number at a time just get handed each lane in turn. */
+
+            auto iterations = juliet::iterations_batch<Width>{};
+
+            for (const auto i : std::views::iota(0uz, Width)) {
+                iterations[i] = set.template iterations_before_escape<MaxIterations>(nums[i]);
+            }
+
+            return iterations;
+        }
+    }
+
+    template<std::size_t MaxIterations, std::size_t Width, typename Scalar>
+    constexpr juliet::escapes_batch<Width> batch_smooth_iterations_before_escape(const juliet::smooth_iterative_set auto &set, const juliet::complex_batch<Width, Scalar> &nums) {
+        if constexpr (requires { { set.template smooth_iterations_before_escape<MaxIterations>(nums) } -> std::same_as<juliet::escapes_batch<Width>>; }) {
+            return set.template smooth_iterations_before_escape<MaxIterations>(nums);
+        } else {
+            auto escapes = juliet::escapes_batch<Width>{};
+
+            for (const auto i : std::views::iota(0uz, Width)) {
+                escapes[i] = set.template smooth_iterations_before_escape<MaxIterations>(nums[i]);
+            }
+
+            return escapes;
+        }
+    }
+
+    /* How far a number is from the boundary of a set, along with its iterations. */
+    struct distance_estimate {
+        std::size_t iterations;
+
+        /*
+            NOTE: Zero for numbers which didn't escape.
+
+            The true distance lies somewhere between a quarter
+            of this and this, so it's best used for telling
+            which numbers are close to the boundary.
+        */
+        juliet::scalar distance;
+
+        /*
+            NOTE: The orbit of a quadratic set as it escaped, along
+            with its derivative, either with respect to the orbit's
+            constant or with respect to where the orbit started.
+        */
+        template<bool WithRespectToConstant>
+        static constexpr distance_estimate from_orbit(
+            const std::size_t iterations,
+            const std::size_t max_iterations,
+
+            juliet::complex_for<juliet::scalar> value,
+            juliet::complex_for<juliet::scalar> derivative,
+
+            const juliet::complex_for<juliet::scalar> &constant
+        ) {
+            static constexpr auto RefinedMagnitudeSquared = 1e10_scalar;
+            static constexpr auto MaxRefinements          = 16uz;
+
+            if (iterations >= max_iterations) {
+                return {iterations, 0.0_scalar};
+            }
+
+            /*
+                NOTE: The estimate is only accurate for escape radii
+                much larger than ours, and so we carry the orbit a
+                little further past it. Each step roughly squares the
+                magnitude, so this only takes a few of them.
+            */
+            for (const auto _ : std::views::iota(0uz, MaxRefinements)) {
+                if (juliet::magnitude_sq(value) >= RefinedMagnitudeSquared) {
+                    break;
                 }
+
+                derivative = 2.0_scalar * value * derivative;
+                if constexpr (WithRespectToConstant) {
+                    derivative += 1.0_scalar;
+                }
+
+                value = value * value + constant;
             }
 
-            return MaxIterations;
+            const auto magnitude_sq = juliet::magnitude_sq(value);
+
+            /* NOTE: See https://en.wikipedia.org/wiki/Plotting_algorithms_for_the_Mandelbrot_set#Exterior_distance_estimation */
+            const auto distance = std::sqrt(magnitude_sq / juliet::magnitude_sq(derivative)) * std::log(magnitude_sq);
+
+            return {iterations, distance};
         }
+
+        friend constexpr bool operator ==(const distance_estimate &lhs, const distance_estimate &rhs) = default;
     };
 
-    static_assert(juliet::iterative_set<juliet::mandelbrot_set_t>);
+    template<std::size_t Width>
+    using distances_batch = std::array<juliet::distance_estimate, Width>;
 
-    constexpr inline auto mandelbrot_set = mandelbrot_set_t{};
+    /* Sets which can estimate the distance of their numbers to their boundary, in the same pass as counting their iterations. */
+    template<typename Set>
+    concept distance_estimating_set = juliet::iterative_set<Set> && requires(const Set &set, const juliet::complex_for<juliet::set_scalar<Set>> num) {
+        { set.template estimate_distance<0uz>(num) } -> std::same_as<juliet::distance_estimate>;
+    };
 
-    struct quadratic_julia_set {
-        juliet::complex constant;
+    template<std::size_t MaxIterations, std::size_t Width, typename Scalar>
+    constexpr juliet::distances_batch<Width> batch_estimate_distances(const juliet::distance_estimating_set auto &set, const juliet::complex_batch<Width, Scalar> &nums) {
+        if constexpr (requires { { set.template estimate_distance<MaxIterations>(nums) } -> std::same_as<juliet::distances_batch<Width>>; }) {
+            return set.template estimate_distance<MaxIterations>(nums);
+        } else {
+            auto distances = juliet::distances_batch<Width>{};
 
-        template<std::size_t MaxIterations>
-        constexpr std::size_t iterations_before_escape(this const quadratic_julia_set self, juliet::complex num) {
-            static constexpr juliet::scalar EscapeMagnitudeSquared = 2.0_scalar * 2.0_scalar;
+            for (const auto i : std::views::iota(0uz, Width)) {
+                distances[i] = set.template estimate_distance<MaxIterations>(nums[i]);
+            }
 
-            auto real_sq = num.real() * num.real();
-            auto imag_sq = num.imag() * num.imag();
+            return distances;
+        }
+    }
 
-            for (const auto i : std::views::iota(0uz, MaxIterations)) {
-                num.imag(2.0_scalar * num.real() * num.imag() + self.constant.imag());
-                num.real(real_sq - imag_sq + self.constant.real());
+    /*
+        Sets whose orbits can be stopped and later continued from
+        where they were, so that iterating them further doesn't
+        have to start over. All orbits start from 'initial_orbit_value'.
+    */
+    template<typename Set>
+    concept resumable_set = juliet::iterative_set<Set> && requires(
+        const Set &set,
 
-                real_sq = num.real() * num.real();
-                imag_sq = num.imag() * num.imag();
+        const juliet::complex_for<juliet::set_scalar<Set>> &num,
+        juliet::complex_for<juliet::set_scalar<Set>> &value,
 
-                if (real_sq + imag_sq > EscapeMagnitudeSquared) {
-                    return i;
+        const std::size_t first_iteration
+    ) {
+        { set.initial_orbit_value(num) } -> std::same_as<juliet::complex_for<juliet::set_scalar<Set>>>;
+
+        { set.template continue_orbit<0uz>(num, value, first_iteration) } -> std::same_as<std::size_t>;
+    };
+
+    template<std::size_t MaxIterations, std::size_t Width, typename Scalar>
+    constexpr juliet::iterations_batch<Width> batch_continue_orbits(
+        const juliet::resumable_set auto &set,
+
+        const juliet::complex_batch<Width, Scalar> &nums,
+        juliet::complex_batch<Width, Scalar> &values,
+
+        const std::size_t first_iteration
+    ) {
+        if constexpr (requires { set.template continue_orbits<MaxIterations>(nums, values, first_iteration); }) {
+            return set.template continue_orbits<MaxIterations>(nums, values, first_iteration);
+        } else {
+            auto iterations = juliet::iterations_batch<Width>{};
+
+            for (const auto i : std::views::iota(0uz, Width)) {
+                auto value = values[i];
+
+                iterations[i] = set.template continue_orbit<MaxIterations>(nums[i], value, first_iteration);
+
+                values.store(i, value);
+            }
+
+            return iterations;
+        }
+    }
+
+    /*
+        Families of sets which differ only by a constant, like Julia
+        sets, which can iterate each number as if it were in the
+        member with a different constant, e.g. to render many
+        members of the family at once.
+    */
+    template<typename Set>
+    concept constant_family_set = juliet::iterative_set<Set> && requires(const Set &set, const juliet::complex_for<juliet::set_scalar<Set>> num) {
+        { set.template iterations_before_escape<0uz>(num, num) } -> std::same_as<std::size_t>;
+    };
+
+    template<std::size_t MaxIterations, std::size_t Width, typename Scalar>
+    constexpr juliet::iterations_batch<Width> batch_iterations_before_escape(
+        const juliet::constant_family_set auto &set,
+
+        const juliet::complex_batch<Width, Scalar> &nums,
+        const juliet::complex_batch<Width, Scalar> &constants
+    ) {
+        if constexpr (requires { { set.template iterations_before_escape<MaxIterations>(nums, constants) } -> std::same_as<juliet::iterations_batch<Width>>; }) {
+            return set.template iterations_before_escape<MaxIterations>(nums, constants);
+        } else {
+            auto iterations = juliet::iterations_batch<Width>{};
+
+            for (const auto i : std::views::iota(0uz, Width)) {
+                iterations[i] = set.template iterations_before_escape<MaxIterations>(nums[i], constants[i]);
+            }
+
+            return iterations;
+        }
+    }
+
+    /* NOTE: How many orbits the interleaved kernels advance together, enough to cover the latency of a chain of multiplies. */
+    constexpr inline std::size_t interleaved_lanes = 8;
+
+    /*
+        Sets which can iterate a whole stream of numbers by
+        advancing several independent orbits at a time, and
+        moving on to the next number in the stream as soon
+        as any one of them escapes.
+
+        NOTE: Each step of an orbit depends on the last, and
+        so iterating a single orbit leaves the processor waiting
+        on each multiply. Interleaving several orbits gives it
+        independent work to fill that time with, without needing
+        vector registers, which is what matters for scalars which
+        can't be vectorized, or on processors with narrow vectors.
+    */
+    template<typename Set>
+    concept interleaved_iterative_set = juliet::iterative_set<Set> && requires(
+        const Set &set,
+
+        std::span<const juliet::complex_for<juliet::set_scalar<Set>>> nums,
+        std::span<std::size_t> iterations
+    ) {
+        set.template interleaved_iterations_before_escape<0uz>(nums, iterations);
+    };
+
+    /*
+        Sets which can hand each value of a number's orbit to a
+        callback, for plotting the orbits themselves, e.g. for
+        the Buddhabrot. The values after the orbit escapes aren't.
+    */
+    template<typename Set>
+    concept orbit_tracing_set = juliet::iterative_set<Set> && requires(const Set &set, const juliet::complex_for<juliet::set_scalar<Set>> num) {
+        { set.template trace_orbit<0uz>(num, [](const juliet::complex_for<juliet::set_scalar<Set>> &) {}) } -> std::same_as<std::size_t>;
+    };
+
+    /*
+        NOTE: Only numbers which are actually iterated are counted, and
+        so not those rejected as interior up front, nor the lanes which
+        pad out batches, so that the counts don't depend on the engine.
+    */
+    struct periodicity_stats {
+        std::atomic<std::size_t> num_points       = 0uz;
+        std::atomic<std::size_t> num_detected     = 0uz;
+        std::atomic<std::size_t> iterations_saved = 0uz;
+
+        /* The fraction of points which were found to be periodic. */
+        std::float64_t detection_rate(this const periodicity_stats &self) {
+            const auto num_points = self.num_points.load(std::memory_order_relaxed);
+            if (num_points == 0) {
+                return 0.0f64;
+            }
+
+            return (
+                static_cast<std::float64_t>(self.num_detected.load(std::memory_order_relaxed)) /
+
+                static_cast<std::float64_t>(num_points)
+            );
+        }
+    };
+
+    template<typename Policy>
+    concept periodicity_policy = std::copyable<Policy> && requires {
+        { Policy::enabled } -> std::convertible_to<bool>;
+    };
+
+    /* The default policy, which doesn't bother checking for periodic orbits. */
+    struct no_periodicity_check {
+        static constexpr bool enabled = false;
+    };
+
+    /*
+        Checks whether an orbit has fallen into a cycle by
+        comparing it against a saved value which is refreshed
+        at doubling intervals, as in Brent's cycle detection.
+
+        Such orbits will never escape, and so we can stop early.
+    */
+    struct periodicity_check {
+        static constexpr bool enabled = true;
+
+        /* How close, in pixels, an orbit must come back to its saved value. */
+        juliet::scalar tolerance = 1.0e-3_scalar;
+
+        /* NOTE: May be shared between threads, and must outlive the set. */
+        juliet::periodicity_stats *stats = nullptr;
+
+        /* NOTE: This is filled in with how many of the lanes being iterated hold real numbers, so that padding isn't counted. */
+        std::size_t num_filled = std::numeric_limits<std::size_t>::max();
+
+        /* NOTE: This is filled in from the tolerance once we know the pixel scale of the frame. */
+        juliet::scalar epsilon_sq = 0;
+
+        constexpr periodicity_check for_frame(this periodicity_check self, const auto &frame) {
+            const auto epsilon = self.tolerance * static_cast<juliet::scalar>(frame.pixel_scale);
+
+            self.epsilon_sq = epsilon * epsilon;
+
+            return self;
+        }
+
+        constexpr void record(this const periodicity_check &self, const std::size_t num_points, const std::size_t num_detected, const std::size_t iterations_saved) {
+            if (self.stats == nullptr) {
+                return;
+            }
+
+            self.stats->num_points.fetch_add(num_points, std::memory_order_relaxed);
+            self.stats->num_detected.fetch_add(num_detected, std::memory_order_relaxed);
+            self.stats->iterations_saved.fetch_add(iterations_saved, std::memory_order_relaxed);
+        }
+    };
+
+    static_assert(juliet::periodicity_policy<juliet::no_periodicity_check>);
+    static_assert(juliet::periodicity_policy<juliet::periodicity_check>);
+
+    /*
+        For Julia sets whose constant has an attracting cycle, which
+        every orbit that doesn't escape is drawn into. Around each
+        point of the cycle is a disk which is proven to be mapped
+        into the disk around the next point, and so orbits which
+        land in any of them will never escape, and can stop early.
+
+        NOTE: Unlike checking for periodicity, this depends on the
+        constant, and so it should be found with 'for_constant'
+        once for each set, e.g. through 'with_attracting_cycle'.
+        Our disks are only proven for the rounding of 'juliet::scalar',
+        and so they shouldn't be used with less precise scalars.
+    */
+    struct attracting_cycle_check {
+        /* NOTE: This doesn't use the periodicity checks of our kernels, but has its own. */
+        static constexpr bool enabled = false;
+
+        static constexpr std::size_t MaxPeriod = 16;
+
+        /* NOTE: A period of zero means no attracting cycle was found, and so nothing is trapped. */
+        std::size_t period = 0;
+
+        std::array<juliet::complex, MaxPeriod> points   = {};
+        std::array<juliet::scalar,  MaxPeriod> radii_sq = {};
+
+        static constexpr attracting_cycle_check for_constant(const juliet::complex constant) {
+            /* NOTE: Past this many iterations, the orbit of zero should have settled into any cycle worth trapping. */
+            static constexpr auto SettleIterations = 10'000uz;
+            static constexpr auto NewtonSteps      = 8uz;
+
+            static constexpr auto PeriodToleranceSq = 1.0e-12_scalar;
+
+            /* NOTE: Weakly attracting cycles would only get tiny disks, and we don't want to mistake neutral ones for attracting. */
+            static constexpr auto MaxMultiplierMagnitude = 0.999_scalar;
+
+            const auto step = [&](const juliet::complex value) {
+                return value * value + constant;
+            };
+
+            auto result = attracting_cycle_check{};
+
+            /* NOTE: Every attracting cycle draws in the orbit of zero, the critical point. */
+            auto value = juliet::complex{};
+            for (const auto _ : std::views::iota(0uz, SettleIterations)) {
+                value = step(value);
+
+                if (juliet::magnitude_sq(value) > 4.0_scalar) {
+                    return result;
                 }
             }
 
-            return MaxIterations;
+            auto period = 0uz;
+            auto cycled = value;
+            for (const auto candidate : std::views::iota(1uz, MaxPeriod + 1)) {
+                cycled = step(cycled);
+
+                if (juliet::magnitude_sq(cycled - value) <= PeriodToleranceSq) {
+                    period = candidate;
+
+                    break;
+                }
+            }
+
+            if (period == 0) {
+                return result;
+            }
+
+            /* NOTE: Newton's method on 'f^period(z) - z', since orbits only converge slowly to weakly attracting cycles. */
+            for (const auto _ : std::views::iota(0uz, NewtonSteps)) {
+                auto image      = value;
+                auto derivative = juliet::complex{1.0_scalar, 0.0_scalar};
+
+                for (const auto _ : std::views::iota(0uz, period)) {
+                    derivative *= 2.0_scalar * image;
+                    image       = step(image);
+                }
+
+                value -= (image - value) / (derivative - 1.0_scalar);
+            }
+
+            auto multiplier = juliet::complex{1.0_scalar, 0.0_scalar};
+            for (const auto i : std::views::iota(0uz, period)) {
+                result.points[i] = value;
+
+                multiplier *= 2.0_scalar * value;
+                value       = step(value);
+            }
+
+            if (juliet::magnitude_sq(multiplier) > MaxMultiplierMagnitude * MaxMultiplierMagnitude) {
+                return result;
+            }
+
+            /*
+                NOTE: If 'z' is within 'r' of a point 'p', then 'z^2 + c'
+                is within 'r * (2|p| + r)' of 'p^2 + c', which is itself
+                within our rounding error of the next point. We look for
+                the largest radius whose disks make it around the cycle
+                back into the first, and which stay within our escape
+                radius so that trapped orbits agree with the plain kernels.
+            */
+            for (const auto exponent : std::views::iota(1, 41)) {
+                const auto initial_radius = std::ldexp(1.0_scalar, -exponent);
+
+                auto radius = initial_radius;
+                auto fits   = true;
+
+                for (const auto i : std::views::iota(0uz, period)) {
+                    const auto point_magnitude = std::sqrt(juliet::magnitude_sq(result.points[i]));
+                    const auto rounding_error  = std::sqrt(juliet::magnitude_sq(step(result.points[i]) - result.points[(i + 1) % period]));
+
+                    if (point_magnitude + radius > 2.0_scalar) {
+                        fits = false;
+
+                        break;
+                    }
+
+                    result.radii_sq[i] = radius * radius;
+
+                    radius = radius * (2.0_scalar * point_magnitude + radius) + rounding_error;
+                }
+
+                if (fits && radius <= initial_radius) {
+                    result.period = period;
+
+                    return result;
+                }
+            }
+
+            return result;
+        }
+
+        /* Whether the orbit has landed in one of our disks, for plain scalars or for each lane of vectors. */
+        template<typename Value>
+        [[gnu::always_inline]]
+        constexpr auto trapped(this const attracting_cycle_check &self, const Value &real, const Value &imag) {
+            auto caught = decltype(real < imag){};
+
+            for (const auto i : std::views::iota(0uz, self.period)) {
+                const auto diff_real = real - simd::broadcast<Value>(self.points[i].real());
+                const auto diff_imag = imag - simd::broadcast<Value>(self.points[i].imag());
+
+                caught = caught | (diff_real * diff_real + diff_imag * diff_imag <= simd::broadcast<Value>(self.radii_sq[i]));
+            }
+
+            return caught;
         }
     };
 
-    static_assert(juliet::iterative_set<juliet::quadratic_julia_set>);
+    static_assert(juliet::periodicity_policy<juliet::attracting_cycle_check>);
+
+    namespace impl {
+
+        /* NOTE: Policies which can tell that an orbit will never escape from where it is, rather than from where it's been. */
+        template<typename Policy>
+        concept orbit_trapping_policy = requires(const Policy &policy, const juliet::scalar value) {
+            policy.trapped(value, value);
+        };
+
+        /* NOTE: Traps only hold for the constant they were found for, so iterating with other constants must go without. */
+        template<juliet::periodicity_policy Periodicity>
+        constexpr auto without_orbit_traps(const Periodicity &periodicity) {
+            if constexpr (impl::orbit_trapping_policy<Periodicity>) {
+                return juliet::no_periodicity_check{};
+            } else {
+                return periodicity;
+            }
+        }
+
+        /* NOTE: For policies which keep statistics, so that they only count the lanes which aren't padding. */
+        template<juliet::periodicity_policy Periodicity>
+        constexpr Periodicity with_filled_lanes(Periodicity periodicity, const std::size_t num_filled) {
+            if constexpr (requires { periodicity.num_filled; }) {
+                periodicity.num_filled = num_filled;
+            }
+
+            return periodicity;
+        }
+
+    }
+
+    namespace impl {
+
+        struct quadratic_step {
+            template<typename Value>
+            [[gnu::always_inline]]
+            static constexpr void operator ()(
+                Value &real,
+                Value &imag,
+
+                const Value &real_sq,
+                const Value &imag_sq,
+
+                const Value &constant_real,
+                const Value &constant_imag
+            ) {
+                /* NOTE: Doubling by addition saves us from splatting a '2' across our lanes. */
+                imag = (real + real) * imag + constant_imag;
+                real = real_sq - imag_sq + constant_real;
+            }
+        };
+
+        /*
+            Like 'quadratic_step', but also carries the derivative
+            of the orbit along with it, either with respect to the
+            constant or with respect to where the orbit started.
+        */
+        template<typename Value, bool WithRespectToConstant>
+        struct quadratic_derivative_step {
+            Value &derivative_real;
+            Value &derivative_imag;
+
+            [[gnu::always_inline]]
+            constexpr void operator ()(
+                this const quadratic_derivative_step &self,
+
+                Value &real,
+                Value &imag,
+
+                const Value &real_sq,
+                const Value &imag_sq,
+
+                const Value &constant_real,
+                const Value &constant_imag
+            ) {
+                /* NOTE: The derivative of 'z^2 + c' is '2z * dz', plus one when it's taken with respect to 'c'. */
+                const auto double_real = real + real;
+                const auto double_imag = imag + imag;
+
+                const auto new_derivative_real = double_real * self.derivative_real - double_imag * self.derivative_imag;
+
+                self.derivative_imag = double_real * self.derivative_imag + double_imag * self.derivative_real;
+
+                if constexpr (WithRespectToConstant) {
+                    self.derivative_real = new_derivative_real + simd::broadcast<Value>(1.0_scalar);
+                } else {
+                    self.derivative_real = new_derivative_real;
+                }
+
+                impl::quadratic_step{}(real, imag, real_sq, imag_sq, constant_real, constant_imag);
+            }
+        };
+
+        /*
+            Raises a number to a power known at compile time by
+            squaring and multiplying, which unrolls into the shortest
+            chain of multiplications for every power below 15.
+
+            NOTE: We're handed the squares of the number's parts, since
+            our kernels have already computed them for checking escapes.
+        */
+        template<std::size_t Power, typename Value>
+        requires (Power >= 1)
+        [[gnu::always_inline]]
+        constexpr std::pair<Value, Value> raise_to_power(const Value &real, const Value &imag, const Value &real_sq, const Value &imag_sq) {
+            if constexpr (Power == 1) {
+                return {real, imag};
+            } else if constexpr (Power == 2) {
+                return {real_sq - imag_sq, (real + real) * imag};
+            } else if constexpr (Power % 2 == 0) {
+                const auto [half_real, half_imag] = impl::raise_to_power<Power / 2>(real, imag, real_sq, imag_sq);
+
+                return {half_real * half_real - half_imag * half_imag, (half_real + half_real) * half_imag};
+            } else {
+                const auto [rest_real, rest_imag] = impl::raise_to_power<Power - 1>(real, imag, real_sq, imag_sq);
+
+                return {rest_real * real - rest_imag * imag, rest_real * imag + rest_imag * real};
+            }
+        }
+
+        /* NOTE: For a degree of 2, this does exactly the same operations as 'quadratic_step'. */
+        template<std::size_t Degree>
+        requires (Degree >= 2)
+        struct power_step {
+            template<typename Value>
+            [[gnu::always_inline]]
+            static constexpr void operator ()(
+                Value &real,
+                Value &imag,
+
+                const Value &real_sq,
+                const Value &imag_sq,
+
+                const Value &constant_real,
+                const Value &constant_imag
+            ) {
+                const auto [power_real, power_imag] = impl::raise_to_power<Degree>(real, imag, real_sq, imag_sq);
+
+                imag = power_imag + constant_imag;
+                real = power_real + constant_real;
+            }
+        };
+
+        /* NOTE: Squares the number after taking the absolute values of its parts. */
+        struct burning_ship_step {
+            template<typename Value>
+            [[gnu::always_inline]]
+            static constexpr void operator ()(
+                Value &real,
+                Value &imag,
+
+                const Value &real_sq,
+                const Value &imag_sq,
+
+                const Value &constant_real,
+                const Value &constant_imag
+            ) {
+                /* NOTE: '2|a||b|' is the same as '|2ab|', which saves us an absolute value. */
+                imag = simd::abs((real + real) * imag) + constant_imag;
+                real = real_sq - imag_sq + constant_real;
+            }
+        };
+
+        /* NOTE: Squares the conjugate of the number. */
+        struct tricorn_step {
+            template<typename Value>
+            [[gnu::always_inline]]
+            static constexpr void operator ()(
+                Value &real,
+                Value &imag,
+
+                const Value &real_sq,
+                const Value &imag_sq,
+
+                const Value &constant_real,
+                const Value &constant_imag
+            ) {
+                imag = constant_imag - (real + real) * imag;
+                real = real_sq - imag_sq + constant_real;
+            }
+        };
+
+        /* NOTE: Squares the number and then takes the absolute value of the real part. */
+        struct celtic_step {
+            template<typename Value>
+            [[gnu::always_inline]]
+            static constexpr void operator ()(
+                Value &real,
+                Value &imag,
+
+                const Value &real_sq,
+                const Value &imag_sq,
+
+                const Value &constant_real,
+                const Value &constant_imag
+            ) {
+                imag = (real + real) * imag + constant_imag;
+                real = simd::abs(real_sq - imag_sq) + constant_real;
+            }
+        };
+
+        /*
+            Iterates an orbit which has already been iterated
+            'first_iteration' times, leaving it where it stopped.
+        */
+        template<std::size_t MaxIterations, typename Value, typename Step, juliet::periodicity_policy Periodicity>
+        [[gnu::always_inline]]
+        constexpr std::size_t continue_point(
+            Value &real,
+            Value &imag,
+
+            const Value constant_real,
+            const Value constant_imag,
+
+            const Step step,
+
+            const Periodicity &periodicity,
+
+            const std::size_t first_iteration
+        ) {
+            static constexpr auto EscapeMagnitudeSquared = static_cast<Value>(2.0_scalar * 2.0_scalar);
+
+            [[maybe_unused]] const auto epsilon_sq = [&]() {
+                if constexpr (Periodicity::enabled) {
+                    return static_cast<Value>(periodicity.epsilon_sq);
+                } else {
+                    return Value{};
+                }
+            }();
+
+            auto real_sq = real * real;
+            auto imag_sq = imag * imag;
+
+            [[maybe_unused]] auto saved_real    = real;
+            [[maybe_unused]] auto saved_imag    = imag;
+            [[maybe_unused]] auto save_interval = 1uz;
+            [[maybe_unused]] auto since_saved   = 0uz;
+
+            for (const auto i : std::views::iota(first_iteration, MaxIterations)) {
+                step(real, imag, real_sq, imag_sq, constant_real, constant_imag);
+
+                real_sq = real * real;
+                imag_sq = imag * imag;
+
+                if (real_sq + imag_sq > EscapeMagnitudeSquared) {
+                    if constexpr (Periodicity::enabled) {
+                        periodicity.record(1, 0, 0);
+                    }
+
+                    return i;
+                }
+
+                if constexpr (impl::orbit_trapping_policy<Periodicity>) {
+                    if (periodicity.trapped(real, imag)) {
+                        return MaxIterations;
+                    }
+                }
+
+                if constexpr (Periodicity::enabled) {
+                    const auto diff_real = real - saved_real;
+                    const auto diff_imag = imag - saved_imag;
+
+                    if (diff_real * diff_real + diff_imag * diff_imag <= epsilon_sq) {
+                        periodicity.record(1, 1, MaxIterations - i);
+
+                        return MaxIterations;
+                    }
+
+                    ++since_saved;
+                    if (since_saved == save_interval) {
+                        saved_real = real;
+                        saved_imag = imag;
+
+                        since_saved    = 0;
+                        save_interval *= 2;
+                    }
+                }
+            }
+
+            if constexpr (Periodicity::enabled) {
+                periodicity.record(1, 0, 0);
+            }
+
+            return MaxIterations;
+        }
+
+        template<std::size_t MaxIterations, typename Value, typename Step, juliet::periodicity_policy Periodicity>
+        [[gnu::always_inline]]
+        constexpr std::size_t iterate_point(
+            Value real,
+            Value imag,
+
+            const Value constant_real,
+            const Value constant_imag,
+
+            const Step step,
+
+            const Periodicity &periodicity
+        ) {
+            return impl::continue_point<MaxIterations>(real, imag, constant_real, constant_imag, step, periodicity, 0uz);
+        }
+
+        /* Like 'iterate_point', but hands each value of the orbit to 'visit' until it escapes. */
+        template<std::size_t MaxIterations, typename Value, typename Step>
+        [[gnu::always_inline]]
+        constexpr std::size_t trace_point(
+            Value real,
+            Value imag,
+
+            const Value constant_real,
+            const Value constant_imag,
+
+            const Step step,
+
+            const auto &visit
+        ) {
+            static constexpr auto EscapeMagnitudeSquared = static_cast<Value>(2.0_scalar * 2.0_scalar);
+
+            auto real_sq = real * real;
+            auto imag_sq = imag * imag;
+
+            for (const auto i : std::views::iota(0uz, MaxIterations)) {
+                step(real, imag, real_sq, imag_sq, constant_real, constant_imag);
+
+                real_sq = real * real;
+                imag_sq = imag * imag;
+
+                if (real_sq + imag_sq > EscapeMagnitudeSquared) {
+                    return i;
+                }
+
+                visit(juliet::complex_for<Value>{real, imag});
+            }
+
+            return MaxIterations;
+        }
+
+        template<typename Value>
+        struct orbit_start {
+            Value real;
+            Value imag;
+
+            Value constant_real;
+            Value constant_imag;
+        };
+
+        /*
+            Iterates each of the 'num_points' points in turn, keeping
+            'NumLanes' of them in flight at once and replacing each as
+            soon as it's done, so that every lane stays busy.
+
+            'start_point(index)' returns where the orbit of a point
+            starts, or nothing if it's already known to never escape.
+            'finish_point(index, iterations)' is passed each result.
+
+            NOTE: Policies which trap orbits, e.g. for attracting
+            cycles, finish them as soon as they're trapped, as with
+            'continue_point'. Other periodicity checks aren't done.
+        */
+        template<std::size_t MaxIterations, std::size_t NumLanes, typename Value, typename Step, juliet::periodicity_policy Periodicity = juliet::no_periodicity_check>
+        constexpr void iterate_interleaved(
+            const std::size_t num_points,
+
+            const auto &start_point,
+            const Step step,
+            const auto &finish_point,
+
+            const Periodicity &periodicity = {}
+        ) {
+            static constexpr auto EscapeMagnitudeSquared = static_cast<Value>(2.0_scalar * 2.0_scalar);
+
+            if constexpr (MaxIterations == 0) {
+                for (const auto index : std::views::iota(0uz, num_points)) {
+                    finish_point(index, 0uz);
+                }
+
+                return;
+            }
+
+            /* NOTE: Idle lanes are left at zero, where they stay without ever escaping. */
+            auto real          = std::array<Value, NumLanes>{};
+            auto imag          = std::array<Value, NumLanes>{};
+            auto constant_real = std::array<Value, NumLanes>{};
+            auto constant_imag = std::array<Value, NumLanes>{};
+
+            auto indices    = std::array<std::size_t, NumLanes>{};
+            auto iterations = std::array<std::size_t, NumLanes>{};
+            auto active     = std::array<bool, NumLanes>{};
+
+            auto next_index = 0uz;
+            auto num_active = 0uz;
+
+            /* Moves the lane onto the next point which actually needs iterating, if there is one. */
+            const auto refill = [&](const std::size_t lane) {
+                while (next_index < num_points) {
+                    const auto index = next_index;
+                    ++next_index;
+
+                    const std::optional<impl::orbit_start<Value>> start = start_point(index);
+                    if (!start.has_value()) {
+                        finish_point(index, MaxIterations);
+
+                        continue;
+                    }
+
+                    real[lane]          = start->real;
+                    imag[lane]          = start->imag;
+                    constant_real[lane] = start->constant_real;
+                    constant_imag[lane] = start->constant_imag;
+
+                    indices[lane]    = index;
+                    iterations[lane] = 0;
+                    active[lane]     = true;
+
+                    return;
+                }
+
+                real[lane]          = Value{};
+                imag[lane]          = Value{};
+                constant_real[lane] = Value{};
+                constant_imag[lane] = Value{};
+
+                active[lane] = false;
+                --num_active;
+            };
+
+            num_active = NumLanes;
+            for (const auto lane : std::views::iota(0uz, NumLanes)) {
+                refill(lane);
+            }
+
+            while (num_active > 0) {
+                /* NOTE: The lanes are independent, so their steps can all be in flight at once. */
+                for (const auto lane : std::views::iota(0uz, NumLanes)) {
+                    const auto real_sq = real[lane] * real[lane];
+                    const auto imag_sq = imag[lane] * imag[lane];
+
+                    step(real[lane], imag[lane], real_sq, imag_sq, constant_real[lane], constant_imag[lane]);
+                }
+
+                for (const auto lane : std::views::iota(0uz, NumLanes)) {
+                    if (!active[lane]) {
+                        continue;
+                    }
+
+                    if (real[lane] * real[lane] + imag[lane] * imag[lane] > EscapeMagnitudeSquared) {
+                        finish_point(indices[lane], iterations[lane]);
+                        refill(lane);
+
+                        continue;
+                    }
+
+                    if constexpr (impl::orbit_trapping_policy<Periodicity>) {
+                        if (periodicity.trapped(real[lane], imag[lane])) {
+                            finish_point(indices[lane], MaxIterations);
+                            refill(lane);
+
+                            continue;
+                        }
+                    }
+
+                    ++iterations[lane];
+                    if (iterations[lane] == MaxIterations) {
+                        finish_point(indices[lane], MaxIterations);
+                        refill(lane);
+                    }
+                }
+            }
+        }
+
+        struct ignore_escapes {
+            static constexpr void operator ()(const auto & /* escaping */, const auto & /* magnitude_sq */) {}
+        };
+
+        /*
+            Iterates every lane in lockstep, keeping a mask
+            of which lanes are still bounded, and stops as
+            soon as every lane has escaped.
+
+            The lanes are left where they stopped, having
+            already been iterated 'first_iteration' times.
+
+            Each iteration, 'on_escape' is passed the mask of
+            lanes which just escaped and their squared magnitudes,
+            since lanes carry on being iterated after they escape.
+        */
+        template<std::size_t MaxIterations, typename Vector, typename Step, juliet::periodicity_policy Periodicity, typename OnEscape = impl::ignore_escapes>
+        [[gnu::always_inline]]
+        constexpr juliet::iterations_batch<simd::width_of<Vector>> continue_lanes(
+            Vector &real,
+            Vector &imag,
+
+            const Vector &constant_real,
+            const Vector &constant_imag,
+
+            const Step step,
+
+            const Periodicity &periodicity,
+
+            /* NOTE: Lanes which are already known to never escape. */
+            const simd::mask_for<Vector> &interior,
+
+            const std::size_t first_iteration,
+
+            const OnEscape &on_escape = {}
+        ) {
+            static constexpr auto EscapeMagnitudeSquared = 2.0_scalar * 2.0_scalar;
+
+            using Mask = simd::mask_for<Vector>;
+
+            const auto escape_magnitude_sq = simd::broadcast<Vector>(EscapeMagnitudeSquared);
+
+            auto real_sq = real * real;
+            auto imag_sq = imag * imag;
+
+            /* NOTE: Bounded lanes have all their bits set, and so subtracting them counts up. */
+            auto bounded    = ~interior;
+            auto iterations = simd::broadcast<Mask>(first_iteration);
+
+            /* NOTE: All lanes move in lockstep, so they can share when to refresh their saved values. */
+            [[maybe_unused]] auto trapped       = Mask{};
+            [[maybe_unused]] auto periodic      = Mask{};
+            [[maybe_unused]] auto saved_real    = real;
+            [[maybe_unused]] auto saved_imag    = imag;
+            [[maybe_unused]] auto save_interval = 1uz;
+            [[maybe_unused]] auto since_saved   = 0uz;
+
+            [[maybe_unused]] const auto epsilon_sq = [&]() {
+                if constexpr (Periodicity::enabled) {
+                    return simd::broadcast<Vector>(periodicity.epsilon_sq);
+                } else {
+                    return Vector{};
+                }
+            }();
+
+            for (const auto _ : std::views::iota(first_iteration, MaxIterations)) {
+                step(real, imag, real_sq, imag_sq, constant_real, constant_imag);
+
+                real_sq = real * real;
+                imag_sq = imag * imag;
+
+                const auto magnitude_sq = real_sq + imag_sq;
+                const auto in_bounds    = (magnitude_sq <= escape_magnitude_sq);
+
+                /* NOTE: When we're not asked about escapes, this is all optimized away. */
+                on_escape(bounded & ~in_bounds, magnitude_sq);
+
+                bounded &= in_bounds;
+
+                if constexpr (impl::orbit_trapping_policy<Periodicity>) {
+                    const auto caught = bounded & periodicity.trapped(real, imag);
+
+                    trapped |= caught;
+                    bounded &= ~caught;
+                }
+
+                if constexpr (Periodicity::enabled) {
+                    const auto diff_real = real - saved_real;
+                    const auto diff_imag = imag - saved_imag;
+
+                    const auto returned = bounded & (diff_real * diff_real + diff_imag * diff_imag <= epsilon_sq);
+
+                    periodic |= returned;
+                    bounded  &= ~returned;
+
+                    ++since_saved;
+                    if (since_saved == save_interval) {
+                        saved_real = real;
+                        saved_imag = imag;
+
+                        since_saved    = 0;
+                        save_interval *= 2;
+                    }
+                }
+
+                if (!simd::any(bounded)) {
+                    break;
+                }
+
+                iterations -= bounded;
+            }
+
+            if constexpr (Periodicity::enabled) {
+                if (periodicity.stats != nullptr) {
+                    auto num_points       = 0uz;
+                    auto num_detected     = 0uz;
+                    auto iterations_saved = 0uz;
+
+                    for (const auto i : std::views::iota(0uz, std::min(simd::width_of<Vector>, periodicity.num_filled))) {
+                        /* NOTE: Like 'continue_point', which is never reached for numbers rejected as interior, we don't count them. */
+                        if (interior[i] != 0) {
+                            continue;
+                        }
+
+                        num_points += 1;
+
+                        if (periodic[i] != 0) {
+                            num_detected     += 1;
+                            iterations_saved += MaxIterations - static_cast<std::size_t>(iterations[i]);
+                        }
+                    }
+
+                    periodicity.record(num_points, num_detected, iterations_saved);
+                }
+
+                iterations = periodic ? simd::broadcast<Mask>(MaxIterations) : iterations;
+            }
+
+            iterations = (interior | trapped) ? simd::broadcast<Mask>(MaxIterations) : iterations;
+
+            return simd::store<std::size_t>(iterations);
+        }
+
+        template<std::size_t MaxIterations, typename Vector, typename Step, juliet::periodicity_policy Periodicity>
+        [[gnu::always_inline]]
+        constexpr juliet::iterations_batch<simd::width_of<Vector>> iterate_lanes(
+            Vector real,
+            Vector imag,
+
+            const Vector &constant_real,
+            const Vector &constant_imag,
+
+            const Step step,
+
+            const Periodicity &periodicity,
+
+            const simd::mask_for<Vector> &interior = {}
+        ) {
+            return impl::continue_lanes<MaxIterations>(real, imag, constant_real, constant_imag, step, periodicity, interior, 0uz);
+        }
+
+        /* Like 'iterate_lanes', but also keeps how each lane escaped. */
+        template<std::size_t MaxIterations, typename Vector, typename Step, juliet::periodicity_policy Periodicity>
+        [[gnu::always_inline]]
+        constexpr juliet::escapes_batch<simd::width_of<Vector>> smooth_iterate_lanes(
+            Vector real,
+            Vector imag,
+
+            const Vector &constant_real,
+            const Vector &constant_imag,
+
+            const Step step,
+
+            const Periodicity &periodicity,
+
+            const simd::mask_for<Vector> &interior = {}
+        ) {
+            auto escape_magnitudes_sq = Vector{};
+
+            const auto iterations = impl::continue_lanes<MaxIterations>(
+                real,
+                imag,
+
+                constant_real,
+                constant_imag,
+
+                step,
+
+                periodicity,
+
+                interior,
+
+                0uz,
+
+                [&](const auto &escaping, const Vector &magnitude_sq) {
+                    escape_magnitudes_sq = escaping ? magnitude_sq : escape_magnitudes_sq;
+                }
+            );
+
+            const auto magnitudes_sq = simd::store<juliet::scalar>(escape_magnitudes_sq);
+
+            auto escapes = juliet::escapes_batch<simd::width_of<Vector>>{};
+            for (const auto i : std::views::iota(0uz, escapes.size())) {
+                escapes[i] = juliet::escape_result::from_orbit(iterations[i], MaxIterations, magnitudes_sq[i]);
+            }
+
+            return escapes;
+        }
+
+        /*
+            Iterates a point along with its derivative, which should
+            start out as the derivative of the orbit's first value.
+        */
+        template<std::size_t MaxIterations, bool WithRespectToConstant, typename Value, juliet::periodicity_policy Periodicity>
+        [[gnu::always_inline]]
+        constexpr juliet::distance_estimate estimate_point_distance(
+            Value real,
+            Value imag,
+
+            const Value constant_real,
+            const Value constant_imag,
+
+            Value derivative_real,
+            Value derivative_imag,
+
+            const Periodicity &periodicity
+        ) {
+            const auto iterations = impl::continue_point<MaxIterations>(
+                real,
+                imag,
+
+                constant_real,
+                constant_imag,
+
+                impl::quadratic_derivative_step<Value, WithRespectToConstant>{derivative_real, derivative_imag},
+
+                periodicity,
+
+                0uz
+            );
+
+            return juliet::distance_estimate::from_orbit<WithRespectToConstant>(
+                iterations,
+                MaxIterations,
+
+                {static_cast<juliet::scalar>(real),            static_cast<juliet::scalar>(imag)},
+                {static_cast<juliet::scalar>(derivative_real), static_cast<juliet::scalar>(derivative_imag)},
+
+                {static_cast<juliet::scalar>(constant_real), static_cast<juliet::scalar>(constant_imag)}
+            );
+        }
+
+        /* Like 'estimate_point_distance', but for every lane in lockstep, as with 'iterate_lanes'. */
+        template<std::size_t MaxIterations, bool WithRespectToConstant, typename Vector, juliet::periodicity_policy Periodicity>
+        [[gnu::always_inline]]
+        constexpr juliet::distances_batch<simd::width_of<Vector>> estimate_lane_distances(
+            Vector real,
+            Vector imag,
+
+            const Vector &constant_real,
+            const Vector &constant_imag,
+
+            Vector derivative_real,
+            Vector derivative_imag,
+
+            const Periodicity &periodicity,
+
+            const simd::mask_for<Vector> &interior = {}
+        ) {
+            auto escape_values_real = Vector{};
+            auto escape_values_imag = Vector{};
+
+            auto escape_derivatives_real = Vector{};
+            auto escape_derivatives_imag = Vector{};
+
+            const auto iterations = impl::continue_lanes<MaxIterations>(
+                real,
+                imag,
+
+                constant_real,
+                constant_imag,
+
+                impl::quadratic_derivative_step<Vector, WithRespectToConstant>{derivative_real, derivative_imag},
+
+                periodicity,
+
+                interior,
+
+                0uz,
+
+                [&](const auto &escaping, const Vector & /* magnitude_sq */) {
+                    escape_values_real = escaping ? real : escape_values_real;
+                    escape_values_imag = escaping ? imag : escape_values_imag;
+
+                    escape_derivatives_real = escaping ? derivative_real : escape_derivatives_real;
+                    escape_derivatives_imag = escaping ? derivative_imag : escape_derivatives_imag;
+                }
+            );
+
+            /* NOTE: The rest of the estimate is scalar work done once per lane, so we leave the lanes for it. */
+            const auto values_real = simd::store<juliet::scalar>(escape_values_real);
+            const auto values_imag = simd::store<juliet::scalar>(escape_values_imag);
+
+            const auto derivatives_real = simd::store<juliet::scalar>(escape_derivatives_real);
+            const auto derivatives_imag = simd::store<juliet::scalar>(escape_derivatives_imag);
+
+            const auto constants_real = simd::store<juliet::scalar>(constant_real);
+            const auto constants_imag = simd::store<juliet::scalar>(constant_imag);
+
+            auto distances = juliet::distances_batch<simd::width_of<Vector>>{};
+            for (const auto i : std::views::iota(0uz, distances.size())) {
+                distances[i] = juliet::distance_estimate::from_orbit<WithRespectToConstant>(
+                    iterations[i],
+                    MaxIterations,
+
+                    {values_real[i],      values_imag[i]},
+                    {derivatives_real[i], derivatives_imag[i]},
+
+                    {constants_real[i], constants_imag[i]}
+                );
+            }
+
+            return distances;
+        }
+
+        /*
+            Calls the kernel, also passing how many of its lanes hold
+            numbers rather than padding if it asks for that, e.g. to
+            keep statistics which shouldn't count the padding.
+        */
+        [[gnu::always_inline]]
+        constexpr decltype(auto) invoke_kernel(const auto &kernel, const std::size_t num_filled, auto &&... args) {
+            if constexpr (std::invocable<decltype(kernel), decltype(args)..., std::size_t>) {
+                return kernel(std::forward<decltype(args)>(args)..., num_filled);
+            } else {
+                return kernel(std::forward<decltype(args)>(args)...);
+            }
+        }
+
+        /* NOTE: How many lanes of the chunk starting at 'offset' hold numbers rather than padding. */
+        constexpr std::size_t filled_in_chunk(const std::size_t num_filled, const std::size_t offset, const std::size_t chunk_width) {
+            return std::min(chunk_width, num_filled - std::min(offset, num_filled));
+        }
+
+        /*
+            Splits the batch up into the vectors native to the instruction set and hands them to the kernel.
+
+            NOTE: The kernel returns an array of results for its
+            lanes, usually their iterations, which we gather up.
+        */
+        template<simd::isa Isa, std::size_t Width, typename Scalar>
+        [[gnu::always_inline]]
+        constexpr auto iterate_batch_as(const juliet::complex_batch<Width, Scalar> &nums, const auto &kernel) {
+            static constexpr auto ChunkWidth = std::min(Width, simd::width<Isa, Scalar>);
+
+            using Vector = simd::vector<Scalar, ChunkWidth>;
+            using Result = typename std::remove_cvref_t<decltype(impl::invoke_kernel(kernel, Width, std::declval<Vector>(), std::declval<Vector>()))>::value_type;
+
+            auto results = std::array<Result, Width>{};
+
+            for (const auto offset : std::views::iota(0uz, Width) | std::views::stride(ChunkWidth)) {
+                const auto chunk_results = impl::invoke_kernel(
+                    kernel,
+
+                    impl::filled_in_chunk(nums.num_filled, offset, ChunkWidth),
+
+                    simd::load<Vector>(nums.real, offset),
+                    simd::load<Vector>(nums.imag, offset)
+                );
+
+                for (const auto i : std::views::iota(0uz, ChunkWidth)) {
+                    results[offset + i] = chunk_results[i];
+                }
+            }
+
+            return results;
+        }
+
+        /*
+            Like 'iterate_batch_as', but for kernels which continue
+            orbits, and so which are also passed the values of the
+            orbits to update along with the numbers themselves.
+        */
+        template<simd::isa Isa, std::size_t Width, typename Scalar>
+        [[gnu::always_inline]]
+        constexpr juliet::iterations_batch<Width> continue_batch_as(
+            const juliet::complex_batch<Width, Scalar> &nums,
+            juliet::complex_batch<Width, Scalar> &values,
+
+            const auto &kernel
+        ) {
+            static constexpr auto ChunkWidth = std::min(Width, simd::width<Isa, Scalar>);
+
+            using Vector = simd::vector<Scalar, ChunkWidth>;
+
+            auto iterations = juliet::iterations_batch<Width>{};
+
+            for (const auto offset : std::views::iota(0uz, Width) | std::views::stride(ChunkWidth)) {
+                auto real = simd::load<Vector>(values.real, offset);
+                auto imag = simd::load<Vector>(values.imag, offset);
+
+                const auto chunk_iterations = impl::invoke_kernel(
+                    kernel,
+
+                    impl::filled_in_chunk(nums.num_filled, offset, ChunkWidth),
+
+                    real,
+                    imag,
+
+                    simd::load<Vector>(nums.real, offset),
+                    simd::load<Vector>(nums.imag, offset)
+                );
+
+                const auto chunk_real = simd::store<Scalar>(real);
+                const auto chunk_imag = simd::store<Scalar>(imag);
+
+                for (const auto i : std::views::iota(0uz, ChunkWidth)) {
+                    iterations[offset + i] = chunk_iterations[i];
+
+                    values.real[offset + i] = chunk_real[i];
+                    values.imag[offset + i] = chunk_imag[i];
+                }
+            }
+
+            return iterations;
+        }
+
+        template<std::size_t Width, typename Scalar>
+        constexpr juliet::iterations_batch<Width> continue_batch(
+            const juliet::complex_batch<Width, Scalar> &nums,
+            juliet::complex_batch<Width, Scalar> &values,
+
+            const auto &kernel
+        ) {
+            if consteval {
+                return impl::continue_batch_as<simd::isa::baseline>(nums, values, kernel);
+            } else {
+                return simd::dispatch([&]<simd::isa Isa>() {
+                    return impl::continue_batch_as<Isa>(nums, values, kernel);
+                });
+            }
+        }
+
+        /*
+            Runs the kernel compiled for the active instruction set.
+
+            The kernel is passed the real and imaginary parts of the
+            numbers as vectors, and should return their iterations.
+        */
+        template<std::size_t Width, typename Scalar>
+        constexpr auto iterate_batch(const juliet::complex_batch<Width, Scalar> &nums, const auto &kernel) {
+            if consteval {
+                return impl::iterate_batch_as<simd::isa::baseline>(nums, kernel);
+            } else {
+                return simd::dispatch([&]<simd::isa Isa>() {
+                    return impl::iterate_batch_as<Isa>(nums, kernel);
+                });
+            }
+        }
+
+    }
+
+    /* Statistics gathered from each orbit, along with its iterations, e.g. for coloring by orbit traps. */
+    template<std::size_t NumOutputs>
+    struct accumulated_orbit {
+        std::size_t iterations;
+
+        std::array<juliet::scalar, NumOutputs> outputs;
+
+        friend constexpr bool operator ==(const accumulated_orbit &lhs, const accumulated_orbit &rhs) = default;
+    };
+
+    template<std::size_t NumOutputs, std::size_t Width>
+    using accumulated_orbits_batch = std::array<juliet::accumulated_orbit<NumOutputs>, Width>;
+
+    /*
+        Policies which gather statistics from every value of an
+        orbit until it escapes, carried in a fixed number of values
+        alongside the orbit which are made into outputs at the end.
+
+        NOTE: Like periodicity policies, accumulators which aren't
+        'enabled' are skipped at compile time, so kernels which are
+        handed one cost exactly the same as kernels which aren't.
+    */
+    template<typename Accumulator>
+    concept orbit_accumulator = std::copyable<Accumulator> && requires {
+        { Accumulator::enabled     } -> std::convertible_to<bool>;
+        { Accumulator::state_size  } -> std::convertible_to<std::size_t>;
+        { Accumulator::num_outputs } -> std::convertible_to<std::size_t>;
+    } && (
+        !Accumulator::enabled ||
+
+        requires(
+            const Accumulator &accumulator,
+
+            std::array<juliet::scalar, Accumulator::state_size> &state,
+
+            const juliet::scalar value
+        ) {
+            { accumulator.template initial_state<juliet::scalar>() } -> std::same_as<std::array<juliet::scalar, Accumulator::state_size>>;
+
+            accumulator.accumulate(state, true, value, value, value, value);
+
+            { accumulator.outputs(std::as_const(state), 0uz) } -> std::same_as<std::array<juliet::scalar, Accumulator::num_outputs>>;
+
+            /* NOTE: A brightness between 0 and 1, for renderers which don't know any better. */
+            { accumulator.shade(accumulator.outputs(std::as_const(state), 0uz)) } -> std::same_as<std::float32_t>;
+        }
+    );
+
+    namespace impl {
+
+        /* NOTE: What accumulators start their minimums at, which every orbit gets under, but which still fits in every scalar we have. */
+        constexpr inline auto unreached_magnitude_sq = 0x1p100_scalar;
+
+    }
+
+    struct no_orbit_accumulator {
+        static constexpr bool enabled = false;
+
+        static constexpr std::size_t state_size  = 0;
+        static constexpr std::size_t num_outputs = 0;
+    };
+
+    /*
+        The closest any value of the orbit comes to a point.
+
+        NOTE: 'bounded' is a mask for vectors and a 'bool' for
+        scalars, and only the values it's set for are counted.
+    */
+    struct point_trap {
+        static constexpr bool enabled = true;
+
+        static constexpr std::size_t state_size  = 1;
+        static constexpr std::size_t num_outputs = 1;
+
+        juliet::complex point = {};
+
+        template<typename Value>
+        constexpr std::array<Value, state_size> initial_state(this const point_trap &) {
+            return {simd::broadcast<Value>(impl::unreached_magnitude_sq)};
+        }
+
+        template<typename Value>
+        [[gnu::always_inline]]
+        constexpr void accumulate(
+            this const point_trap &self,
+
+            std::array<Value, state_size> &state,
+
+            const auto &bounded,
+
+            const Value &real,
+            const Value &imag,
+
+            const Value & /* real_sq */,
+            const Value & /* imag_sq */
+        ) {
+            const auto diff_real = real - simd::broadcast<Value>(self.point.real());
+            const auto diff_imag = imag - simd::broadcast<Value>(self.point.imag());
+
+            const auto distance_sq = diff_real * diff_real + diff_imag * diff_imag;
+
+            state[0] = (bounded & (distance_sq < state[0])) ? distance_sq : state[0];
+        }
+
+        constexpr std::array<juliet::scalar, num_outputs> outputs(this const point_trap &, const std::array<juliet::scalar, state_size> &state, const std::size_t /* iterations */) {
+            return {std::sqrt(state[0])};
+        }
+
+        constexpr std::float32_t shade(this const point_trap &, const std::array<juliet::scalar, num_outputs> &outputs) {
+            return 1.0f32 / (1.0f32 + 8.0f32 * static_cast<std::float32_t>(outputs[0]));
+        }
+    };
+
+    /* The closest any value of the orbit comes to the line through a point along a direction. */
+    struct line_trap {
+        static constexpr bool enabled = true;
+
+        static constexpr std::size_t state_size  = 1;
+        static constexpr std::size_t num_outputs = 1;
+
+        juliet::complex point     = {};
+        juliet::complex direction = {1.0_scalar, 0.0_scalar};
+
+        template<typename Value>
+        constexpr std::array<Value, state_size> initial_state(this const line_trap &) {
+            return {simd::broadcast<Value>(impl::unreached_magnitude_sq)};
+        }
+
+        template<typename Value>
+        [[gnu::always_inline]]
+        constexpr void accumulate(
+            this const line_trap &self,
+
+            std::array<Value, state_size> &state,
+
+            const auto &bounded,
+
+            const Value &real,
+            const Value &imag,
+
+            const Value & /* real_sq */,
+            const Value & /* imag_sq */
+        ) {
+            const auto diff_real = real - simd::broadcast<Value>(self.point.real());
+            const auto diff_imag = imag - simd::broadcast<Value>(self.point.imag());
+
+            /* NOTE: We keep the smallest squared cross product, and only divide by the length of the direction at the end. */
+            const auto cross = diff_real * simd::broadcast<Value>(self.direction.imag()) - diff_imag * simd::broadcast<Value>(self.direction.real());
+
+            const auto cross_sq = cross * cross;
+
+            state[0] = (bounded & (cross_sq < state[0])) ? cross_sq : state[0];
+        }
+
+        constexpr std::array<juliet::scalar, num_outputs> outputs(this const line_trap &self, const std::array<juliet::scalar, state_size> &state, const std::size_t /* iterations */) {
+            return {std::sqrt(state[0] / juliet::magnitude_sq(self.direction))};
+        }
+
+        constexpr std::float32_t shade(this const line_trap &, const std::array<juliet::scalar, num_outputs> &outputs) {
+            return 1.0f32 / (1.0f32 + 8.0f32 * static_cast<std::float32_t>(outputs[0]));
+        }
+    };
+
+    /*
+        The average over the orbit of 'sin(Density * arg(z))',
+        moved into '[0, 1]', which gives stripes following the
+        structure of the set.
+
+        NOTE: For an even density, that's the imaginary part of
+        '(z^2 / |z|^2)^(Density / 2)', which needs no square
+        roots or trigonometry, and so vectorizes.
+    */
+    template<std::size_t Density = 4>
+    requires (Density >= 2 && Density % 2 == 0)
+    struct stripe_average {
+        static constexpr bool enabled = true;
+
+        static constexpr std::size_t state_size  = 1;
+        static constexpr std::size_t num_outputs = 1;
+
+        template<typename Value>
+        constexpr std::array<Value, state_size> initial_state(this const stripe_average &) {
+            return {Value{}};
+        }
+
+        template<typename Value>
+        [[gnu::always_inline]]
+        constexpr void accumulate(
+            this const stripe_average &,
+
+            std::array<Value, state_size> &state,
+
+            const auto &bounded,
+
+            const Value &real,
+            const Value &imag,
+
+            const Value &real_sq,
+            const Value &imag_sq
+        ) {
+            const auto magnitude_sq = real_sq + imag_sq;
+
+            /* NOTE: Orbits can pass through zero, where every angle is as good as any other. */
+            const auto nonzero = (magnitude_sq > Value{});
+            const auto divisor = nonzero ? magnitude_sq : simd::broadcast<Value>(1.0_scalar);
+
+            const auto unit_real = (real_sq - imag_sq) / divisor;
+            const auto unit_imag = ((real + real) * imag) / divisor;
+
+            const auto [power_real, power_imag] = impl::raise_to_power<Density / 2>(unit_real, unit_imag, unit_real * unit_real, unit_imag * unit_imag);
+
+            const auto half = simd::broadcast<Value>(0.5_scalar);
+
+            state[0] = bounded ? state[0] + (half + half * power_imag) : state[0];
+        }
+
+        constexpr std::array<juliet::scalar, num_outputs> outputs(this const stripe_average &, const std::array<juliet::scalar, state_size> &state, const std::size_t iterations) {
+            if (iterations == 0) {
+                return {0.0_scalar};
+            }
+
+            return {state[0] / static_cast<juliet::scalar>(iterations)};
+        }
+
+        constexpr std::float32_t shade(this const stripe_average &, const std::array<juliet::scalar, num_outputs> &outputs) {
+            return static_cast<std::float32_t>(outputs[0]);
+        }
+    };
+
+    /* The smallest and largest magnitudes of the values of the orbit. */
+    struct magnitude_range {
+        static constexpr bool enabled = true;
+
+        static constexpr std::size_t state_size  = 2;
+        static constexpr std::size_t num_outputs = 2;
+
+        template<typename Value>
+        constexpr std::array<Value, state_size> initial_state(this const magnitude_range &) {
+            return {simd::broadcast<Value>(impl::unreached_magnitude_sq), Value{}};
+        }
+
+        template<typename Value>
+        [[gnu::always_inline]]
+        constexpr void accumulate(
+            this const magnitude_range &,
+
+            std::array<Value, state_size> &state,
+
+            const auto &bounded,
+
+            const Value & /* real */,
+            const Value & /* imag */,
+
+            const Value &real_sq,
+            const Value &imag_sq
+        ) {
+            const auto magnitude_sq = real_sq + imag_sq;
+
+            state[0] = (bounded & (magnitude_sq < state[0])) ? magnitude_sq : state[0];
+            state[1] = (bounded & (magnitude_sq > state[1])) ? magnitude_sq : state[1];
+        }
+
+        constexpr std::array<juliet::scalar, num_outputs> outputs(this const magnitude_range &, const std::array<juliet::scalar, state_size> &state, const std::size_t /* iterations */) {
+            return {std::sqrt(state[0]), std::sqrt(state[1])};
+        }
+
+        /* NOTE: Our orbits stay within a magnitude of 2 while they're counted. */
+        constexpr std::float32_t shade(this const magnitude_range &, const std::array<juliet::scalar, num_outputs> &outputs) {
+            return std::clamp(static_cast<std::float32_t>(outputs[0]) / 2.0f32, 0.0f32, 1.0f32);
+        }
+    };
+
+    static_assert(juliet::orbit_accumulator<juliet::no_orbit_accumulator>);
+    static_assert(juliet::orbit_accumulator<juliet::point_trap>);
+    static_assert(juliet::orbit_accumulator<juliet::line_trap>);
+    static_assert(juliet::orbit_accumulator<juliet::stripe_average<>>);
+    static_assert(juliet::orbit_accumulator<juliet::magnitude_range>);
+
+    /* Sets which can gather statistics from their orbits with an accumulator, along with counting their iterations. */
+    template<typename Set>
+    concept accumulating_set = juliet::iterative_set<Set> && requires(const Set &set, const juliet::complex_for<juliet::set_scalar<Set>> num) {
+        { set.template accumulate_orbit<0uz>(num, juliet::no_orbit_accumulator{}) } -> std::same_as<juliet::accumulated_orbit<0>>;
+    };
+
+    template<std::size_t MaxIterations, std::size_t Width, typename Scalar, juliet::orbit_accumulator Accumulator>
+    constexpr juliet::accumulated_orbits_batch<Accumulator::num_outputs, Width> batch_accumulate_orbits(
+        const juliet::accumulating_set auto &set,
+        const juliet::complex_batch<Width, Scalar> &nums,
+        const Accumulator &accumulator
+    ) {
+        if constexpr (requires { { set.template accumulate_orbit<MaxIterations>(nums, accumulator) } -> std::same_as<juliet::accumulated_orbits_batch<Accumulator::num_outputs, Width>>; }) {
+            return set.template accumulate_orbit<MaxIterations>(nums, accumulator);
+        } else {
+            auto orbits = juliet::accumulated_orbits_batch<Accumulator::num_outputs, Width>{};
+
+            for (const auto i : std::views::iota(0uz, Width)) {
+                orbits[i] = set.template accumulate_orbit<MaxIterations>(nums[i], accumulator);
+            }
+
+            return orbits;
+        }
+    }
+
+    namespace impl {
+
+        /*
+            Like 'quadratic_derivative_step', but carries the state
+            of an accumulator along with the orbit, handing it each
+            new value of the orbit which hasn't escaped.
+
+            NOTE: Escaped lanes keep stepping alongside the rest, and
+            can wander back inside the radius, e.g. for Julia sets
+            with large constants, so once a lane has escaped it stays
+            masked out for good.
+        */
+        template<typename Step, typename Accumulator, typename Value>
+        struct accumulating_step {
+            Step step;
+
+            const Accumulator &accumulator;
+
+            std::array<Value, Accumulator::state_size> &state;
+
+            simd::mask_for<Value> &bounded;
+
+            [[gnu::always_inline]]
+            constexpr void operator ()(
+                this const accumulating_step &self,
+
+                Value &real,
+                Value &imag,
+
+                const Value &real_sq,
+                const Value &imag_sq,
+
+                const Value &constant_real,
+                const Value &constant_imag
+            ) {
+                self.step(real, imag, real_sq, imag_sq, constant_real, constant_imag);
+
+                /* NOTE: Our kernels square the new value the same way to check for escapes, and the compiler shares the work. */
+                const auto next_real_sq = real * real;
+                const auto next_imag_sq = imag * imag;
+
+                self.bounded &= (next_real_sq + next_imag_sq <= simd::broadcast<Value>(2.0_scalar * 2.0_scalar));
+
+                self.accumulator.accumulate(self.state, self.bounded, real, imag, next_real_sq, next_imag_sq);
+            }
+        };
+
+        /*
+            Iterates a point while gathering statistics from its orbit.
+
+            NOTE: Periodicity checks would stop orbits before all of
+            their values were counted, and so we go without them.
+        */
+        template<std::size_t MaxIterations, typename Value, typename Step, juliet::orbit_accumulator Accumulator>
+        [[gnu::always_inline]]
+        constexpr juliet::accumulated_orbit<Accumulator::num_outputs> accumulate_point(
+            Value real,
+            Value imag,
+
+            const Value constant_real,
+            const Value constant_imag,
+
+            const Step step,
+
+            const Accumulator &accumulator
+        ) {
+            if constexpr (!Accumulator::enabled) {
+                return {impl::continue_point<MaxIterations>(real, imag, constant_real, constant_imag, step, juliet::no_periodicity_check{}, 0uz), {}};
+            } else {
+                auto state = accumulator.template initial_state<Value>();
+
+                /* NOTE: Every lane starts out bounded. */
+                auto bounded = (simd::broadcast<Value>(0.0_scalar) == simd::broadcast<Value>(0.0_scalar));
+
+                const auto iterations = impl::continue_point<MaxIterations>(
+                    real,
+                    imag,
+
+                    constant_real,
+                    constant_imag,
+
+                    impl::accumulating_step<Step, Accumulator, Value>{step, accumulator, state, bounded},
+
+                    juliet::no_periodicity_check{},
+
+                    0uz
+                );
+
+                auto scalar_state = std::array<juliet::scalar, Accumulator::state_size>{};
+                for (const auto i : std::views::iota(0uz, Accumulator::state_size)) {
+                    scalar_state[i] = static_cast<juliet::scalar>(state[i]);
+                }
+
+                return {iterations, accumulator.outputs(scalar_state, iterations)};
+            }
+        }
+
+        /* Like 'accumulate_point', but for every lane in lockstep, as with 'iterate_lanes'. */
+        template<std::size_t MaxIterations, typename Vector, typename Step, juliet::orbit_accumulator Accumulator>
+        [[gnu::always_inline]]
+        constexpr juliet::accumulated_orbits_batch<Accumulator::num_outputs, simd::width_of<Vector>> accumulate_lanes(
+            Vector real,
+            Vector imag,
+
+            const Vector &constant_real,
+            const Vector &constant_imag,
+
+            const Step step,
+
+            const Accumulator &accumulator
+        ) {
+            static constexpr auto Width = simd::width_of<Vector>;
+
+            auto orbits = juliet::accumulated_orbits_batch<Accumulator::num_outputs, Width>{};
+
+            if constexpr (!Accumulator::enabled) {
+                const auto iterations = impl::continue_lanes<MaxIterations>(real, imag, constant_real, constant_imag, step, juliet::no_periodicity_check{}, simd::mask_for<Vector>{}, 0uz);
+
+                for (const auto i : std::views::iota(0uz, Width)) {
+                    orbits[i].iterations = iterations[i];
+                }
+            } else {
+                auto state = accumulator.template initial_state<Vector>();
+
+                auto bounded = (simd::broadcast<Vector>(0.0_scalar) == simd::broadcast<Vector>(0.0_scalar));
+
+                const auto iterations = impl::continue_lanes<MaxIterations>(
+                    real,
+                    imag,
+
+                    constant_real,
+                    constant_imag,
+
+                    impl::accumulating_step<Step, Accumulator, Vector>{step, accumulator, state, bounded},
+
+                    juliet::no_periodicity_check{},
+
+                    simd::mask_for<Vector>{},
+
+                    0uz
+                );
+
+                /* NOTE: Making the outputs is scalar work done once per lane, so we leave the lanes for it. */
+                auto lane_states = std::array<std::array<juliet::scalar, Width>, Accumulator::state_size>{};
+                for (const auto i : std::views::iota(0uz, Accumulator::state_size)) {
+                    lane_states[i] = simd::store<juliet::scalar>(state[i]);
+                }
+
+                for (const auto lane : std::views::iota(0uz, Width)) {
+                    auto scalar_state = std::array<juliet::scalar, Accumulator::state_size>{};
+                    for (const auto i : std::views::iota(0uz, Accumulator::state_size)) {
+                        scalar_state[i] = lane_states[i][lane];
+                    }
+
+                    orbits[lane] = {iterations[lane], accumulator.outputs(scalar_state, iterations[lane])};
+                }
+            }
+
+            return orbits;
+        }
+
+    }
+
+    template<juliet::periodicity_policy Periodicity = juliet::no_periodicity_check, typename Scalar = juliet::scalar>
+    struct basic_mandelbrot_set {
+        using scalar = Scalar;
+
+        /*
+            NOTE: Numbers in the main cardioid or the period-2 bulb
+            never escape, and we can check for them in closed form
+            instead of spending every iteration on them.
+
+            More-derived sets can turn this off, e.g. to compare
+            against when benchmarking.
+        */
+        static constexpr bool reject_interior_regions = true;
+
+        [[no_unique_address]] Periodicity periodicity = {};
+
+        constexpr auto for_frame(this auto self, const auto &frame, std::size_t /* max_iterations */) requires (Periodicity::enabled) {
+            self.periodicity = self.periodicity.for_frame(frame);
+
+            return self;
+        }
+
+        template<typename OtherScalar>
+        constexpr basic_mandelbrot_set<Periodicity, OtherScalar> with_scalar(this const basic_mandelbrot_set &self) {
+            return {self.periodicity};
+        }
+
+        template<typename Value>
+        [[gnu::always_inline]]
+        static constexpr auto in_interior_region(const Value &real, const Value &imag) {
+            const auto quarter = simd::broadcast<Value>(0.25_scalar);
+            const auto imag_sq = imag * imag;
+
+            /* NOTE: See https://en.wikipedia.org/wiki/Plotting_algorithms_for_the_Mandelbrot_set#Cardioid_/_bulb_checking */
+            const auto cardioid_real = real - quarter;
+            const auto cardioid_q    = cardioid_real * cardioid_real + imag_sq;
+
+            const auto bulb_real = real + simd::broadcast<Value>(1.0_scalar);
+
+            /* NOTE: For vectors, '||' gives us a mask, without short-circuiting. */
+            return (
+                (cardioid_q * (cardioid_q + cardioid_real) <= quarter * imag_sq) ||
+
+                (bulb_real * bulb_real + imag_sq <= simd::broadcast<Value>(0.0625_scalar))
+            );
+        }
+
+        template<std::size_t MaxIterations>
+        constexpr std::size_t iterations_before_escape(this const auto &self, const juliet::complex_for<Scalar> &num) {
+            if constexpr (std::remove_cvref_t<decltype(self)>::reject_interior_regions) {
+                if (basic_mandelbrot_set::in_interior_region(num.real(), num.imag())) {
+                    return MaxIterations;
+                }
+            }
+
+            return impl::iterate_point<MaxIterations>(
+                Scalar{},
+                Scalar{},
+
+                num.real(),
+                num.imag(),
+
+                impl::quadratic_step{},
+
+                self.periodicity
+            );
+        }
+
+        template<std::size_t MaxIterations, std::size_t Width>
+        requires (std::has_single_bit(Width) && simd::vectorizable<Scalar>)
+        constexpr juliet::iterations_batch<Width> iterations_before_escape(this const auto &self, const juliet::complex_batch<Width, Scalar> &nums) {
+            static constexpr auto RejectInteriorRegions = std::remove_cvref_t<decltype(self)>::reject_interior_regions;
+
+            return impl::iterate_batch(nums, [periodicity = self.periodicity]<typename Vector>(const Vector &real, const Vector &imag, const std::size_t num_filled) {
+                const auto interior = [&]() {
+                    if constexpr (RejectInteriorRegions) {
+                        return basic_mandelbrot_set::in_interior_region(real, imag);
+                    } else {
+                        return simd::mask_for<Vector>{};
+                    }
+                }();
+
+                return impl::iterate_lanes<MaxIterations>(
+                    Vector{},
+                    Vector{},
+
+                    real,
+                    imag,
+
+                    impl::quadratic_step{},
+
+                    impl::with_filled_lanes(periodicity, num_filled),
+
+                    interior
+                );
+            });
+        }
+
+        template<std::size_t MaxIterations>
+        requires (!Periodicity::enabled)
+        constexpr void interleaved_iterations_before_escape(
+            this const auto &self,
+
+            const std::span<const juliet::complex_for<Scalar>> nums,
+            const std::span<std::size_t> iterations
+        ) {
+            impl::iterate_interleaved<MaxIterations, juliet::interleaved_lanes, Scalar>(
+                nums.size(),
+
+                [&](const std::size_t index) -> std::optional<impl::orbit_start<Scalar>> {
+                    const auto &num = nums[index];
+
+                    if constexpr (std::remove_cvref_t<decltype(self)>::reject_interior_regions) {
+                        if (basic_mandelbrot_set::in_interior_region(num.real(), num.imag())) {
+                            return std::nullopt;
+                        }
+                    }
+
+                    return impl::orbit_start<Scalar>{Scalar{}, Scalar{}, num.real(), num.imag()};
+                },
+
+                impl::quadratic_step{},
+
+                [&](const std::size_t index, const std::size_t num_iterations) {
+                    iterations[index] = num_iterations;
+                }
+            );
+        }
+
+        template<std::size_t MaxIterations>
+        constexpr juliet::escape_result smooth_iterations_before_escape(this const auto &self, const juliet::complex_for<Scalar> &num) {
+            auto value = self.initial_orbit_value(num);
+
+            const auto iterations = self.template continue_orbit<MaxIterations>(num, value, 0uz);
+
+            return juliet::escape_result::from_orbit(iterations, MaxIterations, juliet::magnitude_sq(value));
+        }
+
+        template<std::size_t MaxIterations, std::size_t Width>
+        requires (std::has_single_bit(Width) && simd::vectorizable<Scalar>)
+        constexpr juliet::escapes_batch<Width> smooth_iterations_before_escape(this const auto &self, const juliet::complex_batch<Width, Scalar> &nums) {
+            static constexpr auto RejectInteriorRegions = std::remove_cvref_t<decltype(self)>::reject_interior_regions;
+
+            return impl::iterate_batch(nums, [periodicity = self.periodicity]<typename Vector>(const Vector &real, const Vector &imag, const std::size_t num_filled) {
+                const auto interior = [&]() {
+                    if constexpr (RejectInteriorRegions) {
+                        return basic_mandelbrot_set::in_interior_region(real, imag);
+                    } else {
+                        return simd::mask_for<Vector>{};
+                    }
+                }();
+
+                return impl::smooth_iterate_lanes<MaxIterations>(
+                    Vector{},
+                    Vector{},
+
+                    real,
+                    imag,
+
+                    impl::quadratic_step{},
+
+                    impl::with_filled_lanes(periodicity, num_filled),
+
+                    interior
+                );
+            });
+        }
+
+        /* NOTE: Numbers in the interior regions are still traced, since their orbits are what's asked for. */
+        template<std::size_t MaxIterations>
+        constexpr std::size_t trace_orbit(this const basic_mandelbrot_set &, const juliet::complex_for<Scalar> &num, const auto &visit) {
+            return impl::trace_point<MaxIterations>(
+                Scalar{},
+                Scalar{},
+
+                num.real(),
+                num.imag(),
+
+                impl::quadratic_step{},
+
+                visit
+            );
+        }
+
+        /* NOTE: Numbers in the interior regions are still iterated, since coloring them by their orbits is usually the point. */
+        template<std::size_t MaxIterations>
+        constexpr auto accumulate_orbit(this const basic_mandelbrot_set &, const juliet::complex_for<Scalar> &num, const juliet::orbit_accumulator auto &accumulator) {
+            return impl::accumulate_point<MaxIterations>(
+                Scalar{},
+                Scalar{},
+
+                num.real(),
+                num.imag(),
+
+                impl::quadratic_step{},
+
+                accumulator
+            );
+        }
+
+        template<std::size_t MaxIterations, std::size_t Width>
+        requires (std::has_single_bit(Width) && simd::vectorizable<Scalar>)
+        constexpr auto accumulate_orbit(this const basic_mandelbrot_set &, const juliet::complex_batch<Width, Scalar> &nums, const juliet::orbit_accumulator auto &accumulator) {
+            return impl::iterate_batch(nums, [&accumulator]<typename Vector>(const Vector &real, const Vector &imag) {
+                return impl::accumulate_lanes<MaxIterations>(
+                    Vector{},
+                    Vector{},
+
+                    real,
+                    imag,
+
+                    impl::quadratic_step{},
+
+                    accumulator
+                );
+            });
+        }
+
+        /* NOTE: Our orbits start from zero, and so their derivatives with respect to the number do too. */
+        template<std::size_t MaxIterations>
+        constexpr juliet::distance_estimate estimate_distance(this const auto &self, const juliet::complex_for<Scalar> &num) {
+            if constexpr (std::remove_cvref_t<decltype(self)>::reject_interior_regions) {
+                if (basic_mandelbrot_set::in_interior_region(num.real(), num.imag())) {
+                    return {MaxIterations, 0.0_scalar};
+                }
+            }
+
+            return impl::estimate_point_distance<MaxIterations, true>(
+                Scalar{},
+                Scalar{},
+
+                num.real(),
+                num.imag(),
+
+                Scalar{},
+                Scalar{},
+
+                self.periodicity
+            );
+        }
+
+        template<std::size_t MaxIterations, std::size_t Width>
+        requires (std::has_single_bit(Width) && simd::vectorizable<Scalar>)
+        constexpr juliet::distances_batch<Width> estimate_distance(this const auto &self, const juliet::complex_batch<Width, Scalar> &nums) {
+            static constexpr auto RejectInteriorRegions = std::remove_cvref_t<decltype(self)>::reject_interior_regions;
+
+            return impl::iterate_batch(nums, [periodicity = self.periodicity]<typename Vector>(const Vector &real, const Vector &imag, const std::size_t num_filled) {
+                const auto interior = [&]() {
+                    if constexpr (RejectInteriorRegions) {
+                        return basic_mandelbrot_set::in_interior_region(real, imag);
+                    } else {
+                        return simd::mask_for<Vector>{};
+                    }
+                }();
+
+                return impl::estimate_lane_distances<MaxIterations, true>(
+                    Vector{},
+                    Vector{},
+
+                    real,
+                    imag,
+
+                    Vector{},
+                    Vector{},
+
+                    impl::with_filled_lanes(periodicity, num_filled),
+
+                    interior
+                );
+            });
+        }
+
+        /* NOTE: Our orbits start from zero, with the number itself as the constant. */
+        constexpr juliet::complex_for<Scalar> initial_orbit_value(this const basic_mandelbrot_set &, const juliet::complex_for<Scalar> &) {
+            return {};
+        }
+
+        template<std::size_t MaxIterations>
+        constexpr std::size_t continue_orbit(
+            this const auto &self,
+
+            const juliet::complex_for<Scalar> &num,
+            juliet::complex_for<Scalar> &value,
+
+            const std::size_t first_iteration
+        ) {
+            if constexpr (std::remove_cvref_t<decltype(self)>::reject_interior_regions) {
+                if (basic_mandelbrot_set::in_interior_region(num.real(), num.imag())) {
+                    return MaxIterations;
+                }
+            }
+
+            auto real = value.real();
+            auto imag = value.imag();
+
+            const auto iterations = impl::continue_point<MaxIterations>(
+                real,
+                imag,
+
+                num.real(),
+                num.imag(),
+
+                impl::quadratic_step{},
+
+                self.periodicity,
+
+                first_iteration
+            );
+
+            value = {real, imag};
+
+            return iterations;
+        }
+
+        template<std::size_t MaxIterations, std::size_t Width>
+        requires (std::has_single_bit(Width) && simd::vectorizable<Scalar>)
+        constexpr juliet::iterations_batch<Width> continue_orbits(
+            this const auto &self,
+
+            const juliet::complex_batch<Width, Scalar> &nums,
+            juliet::complex_batch<Width, Scalar> &values,
+
+            const std::size_t first_iteration
+        ) {
+            static constexpr auto RejectInteriorRegions = std::remove_cvref_t<decltype(self)>::reject_interior_regions;
+
+            return impl::continue_batch(nums, values, [periodicity = self.periodicity, first_iteration]<typename Vector>(
+                Vector &real,
+                Vector &imag,
+
+                const Vector &num_real,
+                const Vector &num_imag,
+
+                const std::size_t num_filled
+            ) {
+                const auto interior = [&]() {
+                    if constexpr (RejectInteriorRegions) {
+                        return basic_mandelbrot_set::in_interior_region(num_real, num_imag);
+                    } else {
+                        return simd::mask_for<Vector>{};
+                    }
+                }();
+
+                return impl::continue_lanes<MaxIterations>(
+                    real,
+                    imag,
+
+                    num_real,
+                    num_imag,
+
+                    impl::quadratic_step{},
+
+                    impl::with_filled_lanes(periodicity, num_filled),
+
+                    interior,
+
+                    first_iteration
+                );
+            });
+        }
+    };
+
+    using mandelbrot_set_t = juliet::basic_mandelbrot_set<>;
+
+    static_assert(juliet::mandelbrot_set_t::in_interior_region(0.0_scalar,   0.0_scalar));
+    static_assert(juliet::mandelbrot_set_t::in_interior_region(-1.0_scalar,  0.0_scalar));
+    static_assert(juliet::mandelbrot_set_t::in_interior_region(-0.1_scalar,  0.6_scalar));
+    static_assert(!juliet::mandelbrot_set_t::in_interior_region(0.3_scalar,  0.0_scalar));
+    static_assert(!juliet::mandelbrot_set_t::in_interior_region(-1.3_scalar, 0.0_scalar));
+
+    static_assert(juliet::iterative_set<juliet::mandelbrot_set_t>);
+    static_assert(juliet::batch_iterative_set<juliet::mandelbrot_set_t, juliet::batch_width>);
+
+    constexpr inline auto mandelbrot_set = mandelbrot_set_t{};
+
+    template<typename Scalar>
+    using mandelbrot_set_for = juliet::basic_mandelbrot_set<juliet::no_periodicity_check, Scalar>;
+
+    template<juliet::periodicity_policy Periodicity = juliet::no_periodicity_check, typename Scalar = juliet::scalar>
+    struct basic_quadratic_julia_set {
+        using scalar = Scalar;
+
+        juliet::complex_for<Scalar> constant;
+
+        [[no_unique_address]] Periodicity periodicity = {};
+
+        constexpr auto for_frame(this auto self, const auto &frame, std::size_t /* max_iterations */) requires (Periodicity::enabled) {
+            self.periodicity = self.periodicity.for_frame(frame);
+
+            return self;
+        }
+
+        template<typename OtherScalar>
+        constexpr basic_quadratic_julia_set<Periodicity, OtherScalar> with_scalar(this const basic_quadratic_julia_set &self) {
+            return {juliet::complex_cast<OtherScalar>(self.constant), self.periodicity};
+        }
+
+        /*
+            NOTE: Finds the attracting cycle of our constant, if there is one,
+            so that orbits drawn into it can stop early. Scalars less precise
+            than 'juliet::scalar' round their orbits by more than our disks
+            allow for, and so they get no disks and iterate as usual.
+        */
+        constexpr basic_quadratic_julia_set<juliet::attracting_cycle_check, Scalar> with_attracting_cycle(this const basic_quadratic_julia_set &self) {
+            if constexpr (impl::scalar_digits<Scalar> < impl::scalar_digits<juliet::scalar>) {
+                return {self.constant, juliet::attracting_cycle_check{}};
+            } else {
+                return {self.constant, juliet::attracting_cycle_check::for_constant(juliet::complex_cast<juliet::scalar>(self.constant))};
+            }
+        }
+
+        template<std::size_t MaxIterations>
+        constexpr std::size_t iterations_before_escape(this const basic_quadratic_julia_set &self, const juliet::complex_for<Scalar> &num) {
+            return impl::iterate_point<MaxIterations>(
+                num.real(),
+                num.imag(),
+
+                self.constant.real(),
+                self.constant.imag(),
+
+                impl::quadratic_step{},
+
+                self.periodicity
+            );
+        }
+
+        template<std::size_t MaxIterations, std::size_t Width>
+        requires (std::has_single_bit(Width) && simd::vectorizable<Scalar>)
+        constexpr juliet::iterations_batch<Width> iterations_before_escape(this const basic_quadratic_julia_set &self, const juliet::complex_batch<Width, Scalar> &nums) {
+            return impl::iterate_batch(nums, [constant = self.constant, periodicity = self.periodicity]<typename Vector>(const Vector &real, const Vector &imag, const std::size_t num_filled) {
+                return impl::iterate_lanes<MaxIterations>(
+                    real,
+                    imag,
+
+                    simd::broadcast<Vector>(constant.real()),
+                    simd::broadcast<Vector>(constant.imag()),
+
+                    impl::quadratic_step{},
+
+                    impl::with_filled_lanes(periodicity, num_filled)
+                );
+            });
+        }
+
+        /* NOTE: Iterates the number as if it were in the member of our family with the given constant instead of ours. */
+        template<std::size_t MaxIterations>
+        constexpr std::size_t iterations_before_escape(this const basic_quadratic_julia_set &self, const juliet::complex_for<Scalar> &num, const juliet::complex_for<Scalar> &constant) {
+            return impl::iterate_point<MaxIterations>(
+                num.real(),
+                num.imag(),
+
+                constant.real(),
+                constant.imag(),
+
+                impl::quadratic_step{},
+
+                impl::without_orbit_traps(self.periodicity)
+            );
+        }
+
+        template<std::size_t MaxIterations, std::size_t Width>
+        requires (std::has_single_bit(Width) && simd::vectorizable<Scalar>)
+        constexpr juliet::iterations_batch<Width> iterations_before_escape(
+            this const basic_quadratic_julia_set &self,
+
+            const juliet::complex_batch<Width, Scalar> &nums,
+            const juliet::complex_batch<Width, Scalar> &constants
+        ) {
+            /* NOTE: Our orbits start from their numbers, so we can pass them as the values of orbits which haven't been iterated yet. */
+            auto values = nums;
+
+            return impl::continue_batch(constants, values, [periodicity = impl::without_orbit_traps(self.periodicity)]<typename Vector>(
+                Vector &real,
+                Vector &imag,
+
+                const Vector &constant_real,
+                const Vector &constant_imag,
+
+                const std::size_t num_filled
+            ) {
+                return impl::iterate_lanes<MaxIterations>(
+                    real,
+                    imag,
+
+                    constant_real,
+                    constant_imag,
+
+                    impl::quadratic_step{},
+
+                    impl::with_filled_lanes(periodicity, num_filled)
+                );
+            });
+        }
+
+        template<std::size_t MaxIterations>
+        requires (!Periodicity::enabled)
+        constexpr void interleaved_iterations_before_escape(
+            this const basic_quadratic_julia_set &self,
+
+            const std::span<const juliet::complex_for<Scalar>> nums,
+            const std::span<std::size_t> iterations
+        ) {
+            impl::iterate_interleaved<MaxIterations, juliet::interleaved_lanes, Scalar>(
+                nums.size(),
+
+                [&](const std::size_t index) -> std::optional<impl::orbit_start<Scalar>> {
+                    const auto &num = nums[index];
+
+                    return impl::orbit_start<Scalar>{num.real(), num.imag(), self.constant.real(), self.constant.imag()};
+                },
+
+                impl::quadratic_step{},
+
+                [&](const std::size_t index, const std::size_t num_iterations) {
+                    iterations[index] = num_iterations;
+                },
+
+                self.periodicity
+            );
+        }
+
+        template<std::size_t MaxIterations>
+        constexpr juliet::escape_result smooth_iterations_before_escape(this const basic_quadratic_julia_set &self, const juliet::complex_for<Scalar> &num) {
+            auto value = self.initial_orbit_value(num);
+
+            const auto iterations = self.template continue_orbit<MaxIterations>(num, value, 0uz);
+
+            return juliet::escape_result::from_orbit(iterations, MaxIterations, juliet::magnitude_sq(value));
+        }
+
+        template<std::size_t MaxIterations, std::size_t Width>
+        requires (std::has_single_bit(Width) && simd::vectorizable<Scalar>)
+        constexpr juliet::escapes_batch<Width> smooth_iterations_before_escape(this const basic_quadratic_julia_set &self, const juliet::complex_batch<Width, Scalar> &nums) {
+            return impl::iterate_batch(nums, [constant = self.constant, periodicity = self.periodicity]<typename Vector>(const Vector &real, const Vector &imag, const std::size_t num_filled) {
+                return impl::smooth_iterate_lanes<MaxIterations>(
+                    real,
+                    imag,
+
+                    simd::broadcast<Vector>(constant.real()),
+                    simd::broadcast<Vector>(constant.imag()),
+
+                    impl::quadratic_step{},
+
+                    impl::with_filled_lanes(periodicity, num_filled)
+                );
+            });
+        }
+
+        /* NOTE: Our orbits start from the number itself, and so their derivatives with respect to it start from one. */
+        template<std::size_t MaxIterations>
+        constexpr juliet::distance_estimate estimate_distance(this const basic_quadratic_julia_set &self, const juliet::complex_for<Scalar> &num) {
+            return impl::estimate_point_distance<MaxIterations, false>(
+                num.real(),
+                num.imag(),
+
+                self.constant.real(),
+                self.constant.imag(),
+
+                static_cast<Scalar>(1.0_scalar),
+                Scalar{},
+
+                self.periodicity
+            );
+        }
+
+        template<std::size_t MaxIterations, std::size_t Width>
+        requires (std::has_single_bit(Width) && simd::vectorizable<Scalar>)
+        constexpr juliet::distances_batch<Width> estimate_distance(this const basic_quadratic_julia_set &self, const juliet::complex_batch<Width, Scalar> &nums) {
+            return impl::iterate_batch(nums, [constant = self.constant, periodicity = self.periodicity]<typename Vector>(const Vector &real, const Vector &imag, const std::size_t num_filled) {
+                return impl::estimate_lane_distances<MaxIterations, false>(
+                    real,
+                    imag,
+
+                    simd::broadcast<Vector>(constant.real()),
+                    simd::broadcast<Vector>(constant.imag()),
+
+                    simd::broadcast<Vector>(1.0_scalar),
+                    Vector{},
+
+                    impl::with_filled_lanes(periodicity, num_filled)
+                );
+            });
+        }
+
+        template<std::size_t MaxIterations>
+        constexpr auto accumulate_orbit(this const basic_quadratic_julia_set &self, const juliet::complex_for<Scalar> &num, const juliet::orbit_accumulator auto &accumulator) {
+            return impl::accumulate_point<MaxIterations>(
+                num.real(),
+                num.imag(),
+
+                self.constant.real(),
+                self.constant.imag(),
+
+                impl::quadratic_step{},
+
+                accumulator
+            );
+        }
+
+        template<std::size_t MaxIterations, std::size_t Width>
+        requires (std::has_single_bit(Width) && simd::vectorizable<Scalar>)
+        constexpr auto accumulate_orbit(this const basic_quadratic_julia_set &self, const juliet::complex_batch<Width, Scalar> &nums, const juliet::orbit_accumulator auto &accumulator) {
+            return impl::iterate_batch(nums, [constant = self.constant, &accumulator]<typename Vector>(const Vector &real, const Vector &imag) {
+                return impl::accumulate_lanes<MaxIterations>(
+                    real,
+                    imag,
+
+                    simd::broadcast<Vector>(constant.real()),
+                    simd::broadcast<Vector>(constant.imag()),
+
+                    impl::quadratic_step{},
+
+                    accumulator
+                );
+            });
+        }
+
+        /* NOTE: Our orbits start from the number itself, with our constant as the constant. */
+        constexpr juliet::complex_for<Scalar> initial_orbit_value(this const basic_quadratic_julia_set &, const juliet::complex_for<Scalar> &num) {
+            return num;
+        }
+
+        template<std::size_t MaxIterations>
+        constexpr std::size_t continue_orbit(
+            this const basic_quadratic_julia_set &self,
+
+            const juliet::complex_for<Scalar> & /* num */,
+            juliet::complex_for<Scalar> &value,
+
+            const std::size_t first_iteration
+        ) {
+            auto real = value.real();
+            auto imag = value.imag();
+
+            const auto iterations = impl::continue_point<MaxIterations>(
+                real,
+                imag,
+
+                self.constant.real(),
+                self.constant.imag(),
+
+                impl::quadratic_step{},
+
+                self.periodicity,
+
+                first_iteration
+            );
+
+            value = {real, imag};
+
+            return iterations;
+        }
+
+        template<std::size_t MaxIterations, std::size_t Width>
+        requires (std::has_single_bit(Width) && simd::vectorizable<Scalar>)
+        constexpr juliet::iterations_batch<Width> continue_orbits(
+            this const basic_quadratic_julia_set &self,
+
+            const juliet::complex_batch<Width, Scalar> &nums,
+            juliet::complex_batch<Width, Scalar> &values,
+
+            const std::size_t first_iteration
+        ) {
+            return impl::continue_batch(nums, values, [constant = self.constant, periodicity = self.periodicity, first_iteration]<typename Vector>(
+                Vector &real,
+                Vector &imag,
+
+                const Vector & /* num_real */,
+                const Vector & /* num_imag */,
+
+                const std::size_t num_filled
+            ) {
+                return impl::continue_lanes<MaxIterations>(
+                    real,
+                    imag,
+
+                    simd::broadcast<Vector>(constant.real()),
+                    simd::broadcast<Vector>(constant.imag()),
+
+                    impl::quadratic_step{},
+
+                    impl::with_filled_lanes(periodicity, num_filled),
+
+                    simd::mask_for<Vector>{},
+
+                    first_iteration
+                );
+            });
+        }
+    };
+
+    using quadratic_julia_set = juliet::basic_quadratic_julia_set<>;
+
+    template<typename Scalar>
+    using quadratic_julia_set_for = juliet::basic_quadratic_julia_set<juliet::no_periodicity_check, Scalar>;
+
+    static_assert(juliet::iterative_set<juliet::quadratic_julia_set>);
+    static_assert(juliet::batch_iterative_set<juliet::quadratic_julia_set, juliet::batch_width>);
+
+    /* The sets of numbers 'c' for which 'z^Degree + c' doesn't escape when starting from zero. */
+    template<std::size_t Degree, juliet::periodicity_policy Periodicity = juliet::no_periodicity_check, typename Scalar = juliet::scalar>
+    requires (Degree >= 2)
+    struct basic_multibrot_set {
+        using scalar = Scalar;
+
+        [[no_unique_address]] Periodicity periodicity = {};
+
+        constexpr auto for_frame(this auto self, const auto &frame, std::size_t /* max_iterations */) requires (Periodicity::enabled) {
+            self.periodicity = self.periodicity.for_frame(frame);
+
+            return self;
+        }
+
+        template<typename OtherScalar>
+        constexpr basic_multibrot_set<Degree, Periodicity, OtherScalar> with_scalar(this const basic_multibrot_set &self) {
+            return {self.periodicity};
+        }
+
+        template<std::size_t MaxIterations>
+        constexpr std::size_t iterations_before_escape(this const basic_multibrot_set &self, const juliet::complex_for<Scalar> &num) {
+            return impl::iterate_point<MaxIterations>(
+                Scalar{},
+                Scalar{},
+
+                num.real(),
+                num.imag(),
+
+                impl::power_step<Degree>{},
+
+                self.periodicity
+            );
+        }
+
+        template<std::size_t MaxIterations, std::size_t Width>
+        requires (std::has_single_bit(Width) && simd::vectorizable<Scalar>)
+        constexpr juliet::iterations_batch<Width> iterations_before_escape(this const basic_multibrot_set &self, const juliet::complex_batch<Width, Scalar> &nums) {
+            return impl::iterate_batch(nums, [periodicity = self.periodicity]<typename Vector>(const Vector &real, const Vector &imag, const std::size_t num_filled) {
+                return impl::iterate_lanes<MaxIterations>(
+                    Vector{},
+                    Vector{},
+
+                    real,
+                    imag,
+
+                    impl::power_step<Degree>{},
+
+                    impl::with_filled_lanes(periodicity, num_filled)
+                );
+            });
+        }
+
+        template<std::size_t MaxIterations>
+        requires (!Periodicity::enabled)
+        constexpr void interleaved_iterations_before_escape(
+            this const basic_multibrot_set &,
+
+            const std::span<const juliet::complex_for<Scalar>> nums,
+            const std::span<std::size_t> iterations
+        ) {
+            impl::iterate_interleaved<MaxIterations, juliet::interleaved_lanes, Scalar>(
+                nums.size(),
+
+                [&](const std::size_t index) -> std::optional<impl::orbit_start<Scalar>> {
+                    const auto &num = nums[index];
+
+                    return impl::orbit_start<Scalar>{Scalar{}, Scalar{}, num.real(), num.imag()};
+                },
+
+                impl::power_step<Degree>{},
+
+                [&](const std::size_t index, const std::size_t num_iterations) {
+                    iterations[index] = num_iterations;
+                }
+            );
+        }
+
+        template<std::size_t MaxIterations>
+        constexpr std::size_t trace_orbit(this const basic_multibrot_set &, const juliet::complex_for<Scalar> &num, const auto &visit) {
+            return impl::trace_point<MaxIterations>(
+                Scalar{},
+                Scalar{},
+
+                num.real(),
+                num.imag(),
+
+                impl::power_step<Degree>{},
+
+                visit
+            );
+        }
+
+        /* NOTE: Our orbits start from zero, with the number itself as the constant. */
+        constexpr juliet::complex_for<Scalar> initial_orbit_value(this const basic_multibrot_set &, const juliet::complex_for<Scalar> &) {
+            return {};
+        }
+
+        template<std::size_t MaxIterations>
+        constexpr std::size_t continue_orbit(
+            this const basic_multibrot_set &self,
+
+            const juliet::complex_for<Scalar> &num,
+            juliet::complex_for<Scalar> &value,
+
+            const std::size_t first_iteration
+        ) {
+            auto real = value.real();
+            auto imag = value.imag();
+
+            const auto iterations = impl::continue_point<MaxIterations>(
+                real,
+                imag,
+
+                num.real(),
+                num.imag(),
+
+                impl::power_step<Degree>{},
+
+                self.periodicity,
+
+                first_iteration
+            );
+
+            value = {real, imag};
+
+            return iterations;
+        }
+
+        template<std::size_t MaxIterations, std::size_t Width>
+        requires (std::has_single_bit(Width) && simd::vectorizable<Scalar>)
+        constexpr juliet::iterations_batch<Width> continue_orbits(
+            this const basic_multibrot_set &self,
+
+            const juliet::complex_batch<Width, Scalar> &nums,
+            juliet::complex_batch<Width, Scalar> &values,
+
+            const std::size_t first_iteration
+        ) {
+            return impl::continue_batch(nums, values, [periodicity = self.periodicity, first_iteration]<typename Vector>(
+                Vector &real,
+                Vector &imag,
+
+                const Vector &num_real,
+                const Vector &num_imag,
+
+                const std::size_t num_filled
+            ) {
+                return impl::continue_lanes<MaxIterations>(
+                    real,
+                    imag,
+
+                    num_real,
+                    num_imag,
+
+                    impl::power_step<Degree>{},
+
+                    impl::with_filled_lanes(periodicity, num_filled),
+
+                    simd::mask_for<Vector>{},
+
+                    first_iteration
+                );
+            });
+        }
+    };
+
+    template<std::size_t Degree>
+    using multibrot_set_t = juliet::basic_multibrot_set<Degree>;
+
+    template<std::size_t Degree>
+    constexpr inline auto multibrot_set = juliet::multibrot_set_t<Degree>{};
+
+    template<std::size_t Degree, typename Scalar>
+    using multibrot_set_for = juliet::basic_multibrot_set<Degree, juliet::no_periodicity_check, Scalar>;
+
+    static_assert(juliet::iterative_set<juliet::multibrot_set_t<3>>);
+    static_assert(juliet::batch_iterative_set<juliet::multibrot_set_t<3>, juliet::batch_width>);
+
+    /* The sets of numbers for which 'z^Degree + constant' doesn't escape when starting from the number. */
+    template<std::size_t Degree, juliet::periodicity_policy Periodicity = juliet::no_periodicity_check, typename Scalar = juliet::scalar>
+    requires (Degree >= 2)
+    struct basic_multi_julia_set {
+        using scalar = Scalar;
+
+        juliet::complex_for<Scalar> constant;
+
+        [[no_unique_address]] Periodicity periodicity = {};
+
+        constexpr auto for_frame(this auto self, const auto &frame, std::size_t /* max_iterations */) requires (Periodicity::enabled) {
+            self.periodicity = self.periodicity.for_frame(frame);
+
+            return self;
+        }
+
+        template<typename OtherScalar>
+        constexpr basic_multi_julia_set<Degree, Periodicity, OtherScalar> with_scalar(this const basic_multi_julia_set &self) {
+            return {juliet::complex_cast<OtherScalar>(self.constant), self.periodicity};
+        }
+
+        template<std::size_t MaxIterations>
+        constexpr std::size_t iterations_before_escape(this const basic_multi_julia_set &self, const juliet::complex_for<Scalar> &num) {
+            return impl::iterate_point<MaxIterations>(
+                num.real(),
+                num.imag(),
+
+                self.constant.real(),
+                self.constant.imag(),
+
+                impl::power_step<Degree>{},
+
+                self.periodicity
+            );
+        }
+
+        template<std::size_t MaxIterations, std::size_t Width>
+        requires (std::has_single_bit(Width) && simd::vectorizable<Scalar>)
+        constexpr juliet::iterations_batch<Width> iterations_before_escape(this const basic_multi_julia_set &self, const juliet::complex_batch<Width, Scalar> &nums) {
+            return impl::iterate_batch(nums, [constant = self.constant, periodicity = self.periodicity]<typename Vector>(const Vector &real, const Vector &imag, const std::size_t num_filled) {
+                return impl::iterate_lanes<MaxIterations>(
+                    real,
+                    imag,
+
+                    simd::broadcast<Vector>(constant.real()),
+                    simd::broadcast<Vector>(constant.imag()),
+
+                    impl::power_step<Degree>{},
+
+                    impl::with_filled_lanes(periodicity, num_filled)
+                );
+            });
+        }
+
+        /* NOTE: Iterates the number as if it were in the member of our family with the given constant instead of ours. */
+        template<std::size_t MaxIterations>
+        constexpr std::size_t iterations_before_escape(this const basic_multi_julia_set &self, const juliet::complex_for<Scalar> &num, const juliet::complex_for<Scalar> &constant) {
+            return impl::iterate_point<MaxIterations>(
+                num.real(),
+                num.imag(),
+
+                constant.real(),
+                constant.imag(),
+
+                impl::power_step<Degree>{},
+
+                impl::without_orbit_traps(self.periodicity)
+            );
+        }
+
+        template<std::size_t MaxIterations, std::size_t Width>
+        requires (std::has_single_bit(Width) && simd::vectorizable<Scalar>)
+        constexpr juliet::iterations_batch<Width> iterations_before_escape(
+            this const basic_multi_julia_set &self,
+
+            const juliet::complex_batch<Width, Scalar> &nums,
+            const juliet::complex_batch<Width, Scalar> &constants
+        ) {
+            /* NOTE: Our orbits start from their numbers, so we can pass them as the values of orbits which haven't been iterated yet. */
+            auto values = nums;
+
+            return impl::continue_batch(constants, values, [periodicity = impl::without_orbit_traps(self.periodicity)]<typename Vector>(
+                Vector &real,
+                Vector &imag,
+
+                const Vector &constant_real,
+                const Vector &constant_imag,
+
+                const std::size_t num_filled
+            ) {
+                return impl::iterate_lanes<MaxIterations>(
+                    real,
+                    imag,
+
+                    constant_real,
+                    constant_imag,
+
+                    impl::power_step<Degree>{},
+
+                    impl::with_filled_lanes(periodicity, num_filled)
+                );
+            });
+        }
+
+        template<std::size_t MaxIterations>
+        requires (!Periodicity::enabled)
+        constexpr void interleaved_iterations_before_escape(
+            this const basic_multi_julia_set &self,
+
+            const std::span<const juliet::complex_for<Scalar>> nums,
+            const std::span<std::size_t> iterations
+        ) {
+            impl::iterate_interleaved<MaxIterations, juliet::interleaved_lanes, Scalar>(
+                nums.size(),
+
+                [&](const std::size_t index) -> std::optional<impl::orbit_start<Scalar>> {
+                    const auto &num = nums[index];
+
+                    return impl::orbit_start<Scalar>{num.real(), num.imag(), self.constant.real(), self.constant.imag()};
+                },
+
+                impl::power_step<Degree>{},
+
+                [&](const std::size_t index, const std::size_t num_iterations) {
+                    iterations[index] = num_iterations;
+                }
+            );
+        }
+
+        /* NOTE: Our orbits start from the number itself, with our constant as the constant. */
+        constexpr juliet::complex_for<Scalar> initial_orbit_value(this const basic_multi_julia_set &, const juliet::complex_for<Scalar> &num) {
+            return num;
+        }
+
+        template<std::size_t MaxIterations>
+        constexpr std::size_t continue_orbit(
+            this const basic_multi_julia_set &self,
+
+            const juliet::complex_for<Scalar> & /* num */,
+            juliet::complex_for<Scalar> &value,
+
+            const std::size_t first_iteration
+        ) {
+            auto real = value.real();
+            auto imag = value.imag();
+
+            const auto iterations = impl::continue_point<MaxIterations>(
+                real,
+                imag,
+
+                self.constant.real(),
+                self.constant.imag(),
+
+                impl::power_step<Degree>{},
+
+                self.periodicity,
+
+                first_iteration
+            );
+
+            value = {real, imag};
+
+            return iterations;
+        }
+
+        template<std::size_t MaxIterations, std::size_t Width>
+        requires (std::has_single_bit(Width) && simd::vectorizable<Scalar>)
+        constexpr juliet::iterations_batch<Width> continue_orbits(
+            this const basic_multi_julia_set &self,
+
+            const juliet::complex_batch<Width, Scalar> &nums,
+            juliet::complex_batch<Width, Scalar> &values,
+
+            const std::size_t first_iteration
+        ) {
+            return impl::continue_batch(nums, values, [constant = self.constant, periodicity = self.periodicity, first_iteration]<typename Vector>(
+                Vector &real,
+                Vector &imag,
+
+                const Vector & /* num_real */,
+                const Vector & /* num_imag */,
+
+                const std::size_t num_filled
+            ) {
+                return impl::continue_lanes<MaxIterations>(
+                    real,
+                    imag,
+
+                    simd::broadcast<Vector>(constant.real()),
+                    simd::broadcast<Vector>(constant.imag()),
+
+                    impl::power_step<Degree>{},
+
+                    impl::with_filled_lanes(periodicity, num_filled),
+
+                    simd::mask_for<Vector>{},
+
+                    first_iteration
+                );
+            });
+        }
+    };
+
+    template<std::size_t Degree>
+    using multi_julia_set = juliet::basic_multi_julia_set<Degree>;
+
+    template<std::size_t Degree, typename Scalar>
+    using multi_julia_set_for = juliet::basic_multi_julia_set<Degree, juliet::no_periodicity_check, Scalar>;
+
+    static_assert(juliet::iterative_set<juliet::multi_julia_set<3>>);
+    static_assert(juliet::batch_iterative_set<juliet::multi_julia_set<3>, juliet::batch_width>);
+
+    /*
+        The sets of numbers whose orbits under 'Step' don't escape
+        when starting from zero, with the number as the constant,
+        for variations on the Mandelbrot set like the Burning Ship.
+    */
+    template<typename Step, juliet::periodicity_policy Periodicity = juliet::no_periodicity_check, typename Scalar = juliet::scalar>
+    struct basic_escape_time_set {
+        using scalar = Scalar;
+
+        [[no_unique_address]] Periodicity periodicity = {};
+
+        constexpr auto for_frame(this auto self, const auto &frame, std::size_t /* max_iterations */) requires (Periodicity::enabled) {
+            self.periodicity = self.periodicity.for_frame(frame);
+
+            return self;
+        }
+
+        template<typename OtherScalar>
+        constexpr basic_escape_time_set<Step, Periodicity, OtherScalar> with_scalar(this const basic_escape_time_set &self) {
+            return {self.periodicity};
+        }
+
+        template<std::size_t MaxIterations>
+        constexpr std::size_t iterations_before_escape(this const basic_escape_time_set &self, const juliet::complex_for<Scalar> &num) {
+            return impl::iterate_point<MaxIterations>(
+                Scalar{},
+                Scalar{},
+
+                num.real(),
+                num.imag(),
+
+                Step{},
+
+                self.periodicity
+            );
+        }
+
+        template<std::size_t MaxIterations, std::size_t Width>
+        requires (std::has_single_bit(Width) && simd::vectorizable<Scalar>)
+        constexpr juliet::iterations_batch<Width> iterations_before_escape(this const basic_escape_time_set &self, const juliet::complex_batch<Width, Scalar> &nums) {
+            return impl::iterate_batch(nums, [periodicity = self.periodicity]<typename Vector>(const Vector &real, const Vector &imag, const std::size_t num_filled) {
+                return impl::iterate_lanes<MaxIterations>(
+                    Vector{},
+                    Vector{},
+
+                    real,
+                    imag,
+
+                    Step{},
+
+                    impl::with_filled_lanes(periodicity, num_filled)
+                );
+            });
+        }
+
+        template<std::size_t MaxIterations>
+        requires (!Periodicity::enabled)
+        constexpr void interleaved_iterations_before_escape(
+            this const basic_escape_time_set &,
+
+            const std::span<const juliet::complex_for<Scalar>> nums,
+            const std::span<std::size_t> iterations
+        ) {
+            impl::iterate_interleaved<MaxIterations, juliet::interleaved_lanes, Scalar>(
+                nums.size(),
+
+                [&](const std::size_t index) -> std::optional<impl::orbit_start<Scalar>> {
+                    const auto &num = nums[index];
+
+                    return impl::orbit_start<Scalar>{Scalar{}, Scalar{}, num.real(), num.imag()};
+                },
+
+                Step{},
+
+                [&](const std::size_t index, const std::size_t num_iterations) {
+                    iterations[index] = num_iterations;
+                }
+            );
+        }
+
+        template<std::size_t MaxIterations>
+        constexpr std::size_t trace_orbit(this const basic_escape_time_set &, const juliet::complex_for<Scalar> &num, const auto &visit) {
+            return impl::trace_point<MaxIterations>(
+                Scalar{},
+                Scalar{},
+
+                num.real(),
+                num.imag(),
+
+                Step{},
+
+                visit
+            );
+        }
+
+        template<std::size_t MaxIterations>
+        constexpr auto accumulate_orbit(this const basic_escape_time_set &, const juliet::complex_for<Scalar> &num, const juliet::orbit_accumulator auto &accumulator) {
+            return impl::accumulate_point<MaxIterations>(
+                Scalar{},
+                Scalar{},
+
+                num.real(),
+                num.imag(),
+
+                Step{},
+
+                accumulator
+            );
+        }
+
+        template<std::size_t MaxIterations, std::size_t Width>
+        requires (std::has_single_bit(Width) && simd::vectorizable<Scalar>)
+        constexpr auto accumulate_orbit(this const basic_escape_time_set &, const juliet::complex_batch<Width, Scalar> &nums, const juliet::orbit_accumulator auto &accumulator) {
+            return impl::iterate_batch(nums, [&accumulator]<typename Vector>(const Vector &real, const Vector &imag) {
+                return impl::accumulate_lanes<MaxIterations>(
+                    Vector{},
+                    Vector{},
+
+                    real,
+                    imag,
+
+                    Step{},
+
+                    accumulator
+                );
+            });
+        }
+
+        /* NOTE: Our orbits start from zero, with the number itself as the constant. */
+        constexpr juliet::complex_for<Scalar> initial_orbit_value(this const basic_escape_time_set &, const juliet::complex_for<Scalar> &) {
+            return {};
+        }
+
+        template<std::size_t MaxIterations>
+        constexpr std::size_t continue_orbit(
+            this const basic_escape_time_set &self,
+
+            const juliet::complex_for<Scalar> &num,
+            juliet::complex_for<Scalar> &value,
+
+            const std::size_t first_iteration
+        ) {
+            auto real = value.real();
+            auto imag = value.imag();
+
+            const auto iterations = impl::continue_point<MaxIterations>(
+                real,
+                imag,
+
+                num.real(),
+                num.imag(),
+
+                Step{},
+
+                self.periodicity,
+
+                first_iteration
+            );
+
+            value = {real, imag};
+
+            return iterations;
+        }
+
+        template<std::size_t MaxIterations, std::size_t Width>
+        requires (std::has_single_bit(Width) && simd::vectorizable<Scalar>)
+        constexpr juliet::iterations_batch<Width> continue_orbits(
+            this const basic_escape_time_set &self,
+
+            const juliet::complex_batch<Width, Scalar> &nums,
+            juliet::complex_batch<Width, Scalar> &values,
+
+            const std::size_t first_iteration
+        ) {
+            return impl::continue_batch(nums, values, [periodicity = self.periodicity, first_iteration]<typename Vector>(
+                Vector &real,
+                Vector &imag,
+
+                const Vector &num_real,
+                const Vector &num_imag,
+
+                const std::size_t num_filled
+            ) {
+                return impl::continue_lanes<MaxIterations>(
+                    real,
+                    imag,
+
+                    num_real,
+                    num_imag,
+
+                    Step{},
+
+                    impl::with_filled_lanes(periodicity, num_filled),
+
+                    simd::mask_for<Vector>{},
+
+                    first_iteration
+                );
+            });
+        }
+    };
+
+    template<juliet::periodicity_policy Periodicity = juliet::no_periodicity_check, typename Scalar = juliet::scalar>
+    using basic_burning_ship_set = juliet::basic_escape_time_set<impl::burning_ship_step, Periodicity, Scalar>;
+
+    template<juliet::periodicity_policy Periodicity = juliet::no_periodicity_check, typename Scalar = juliet::scalar>
+    using basic_tricorn_set = juliet::basic_escape_time_set<impl::tricorn_step, Periodicity, Scalar>;
+
+    template<juliet::periodicity_policy Periodicity = juliet::no_periodicity_check, typename Scalar = juliet::scalar>
+    using basic_celtic_set = juliet::basic_escape_time_set<impl::celtic_step, Periodicity, Scalar>;
+
+    using burning_ship_set_t = juliet::basic_burning_ship_set<>;
+    using tricorn_set_t      = juliet::basic_tricorn_set<>;
+    using celtic_set_t       = juliet::basic_celtic_set<>;
+
+    constexpr inline auto burning_ship_set = juliet::burning_ship_set_t{};
+    constexpr inline auto tricorn_set      = juliet::tricorn_set_t{};
+    constexpr inline auto celtic_set       = juliet::celtic_set_t{};
+
+    template<typename Scalar>
+    using burning_ship_set_for = juliet::basic_burning_ship_set<juliet::no_periodicity_check, Scalar>;
+
+    template<typename Scalar>
+    using tricorn_set_for = juliet::basic_tricorn_set<juliet::no_periodicity_check, Scalar>;
+
+    template<typename Scalar>
+    using celtic_set_for = juliet::basic_celtic_set<juliet::no_periodicity_check, Scalar>;
+
+    static_assert(juliet::iterative_set<juliet::burning_ship_set_t>);
+    static_assert(juliet::iterative_set<juliet::tricorn_set_t>);
+    static_assert(juliet::iterative_set<juliet::celtic_set_t>);
+
+    static_assert(juliet::batch_iterative_set<juliet::burning_ship_set_t, juliet::batch_width>);
+    static_assert(juliet::batch_iterative_set<juliet::tricorn_set_t,      juliet::batch_width>);
+    static_assert(juliet::batch_iterative_set<juliet::celtic_set_t,       juliet::batch_width>);
+
+    /* Sets which can be iterated with other scalars than their own, e.g. to trade precision for speed. */
+    template<typename Set>
+    concept rescalable_set = juliet::iterative_set<Set> && requires(const Set &set) {
+        { set.template with_scalar<std::float32_t>() }      -> juliet::iterative_set;
+        { set.template with_scalar<juliet::quad_double>() } -> juliet::iterative_set;
+    };
+
+    static_assert(juliet::rescalable_set<juliet::mandelbrot_set_t>);
+    static_assert(juliet::rescalable_set<juliet::quadratic_julia_set>);
+    static_assert(juliet::rescalable_set<juliet::multibrot_set_t<3>>);
+    static_assert(juliet::rescalable_set<juliet::multi_julia_set<3>>);
+    static_assert(juliet::rescalable_set<juliet::burning_ship_set_t>);
+
+    static_assert(juliet::resumable_set<juliet::mandelbrot_set_t>);
+    static_assert(juliet::resumable_set<juliet::quadratic_julia_set>);
+    static_assert(juliet::resumable_set<juliet::multibrot_set_t<3>>);
+    static_assert(juliet::resumable_set<juliet::multi_julia_set<3>>);
+    static_assert(juliet::resumable_set<juliet::burning_ship_set_t>);
+
+    static_assert(juliet::smooth_iterative_set<juliet::mandelbrot_set_t>);
+    static_assert(juliet::smooth_iterative_set<juliet::quadratic_julia_set>);
+
+    static_assert(juliet::orbit_tracing_set<juliet::mandelbrot_set_t>);
+    static_assert(juliet::orbit_tracing_set<juliet::multibrot_set_t<3>>);
+    static_assert(juliet::orbit_tracing_set<juliet::burning_ship_set_t>);
+
+    static_assert(juliet::distance_estimating_set<juliet::mandelbrot_set_t>);
+    static_assert(juliet::distance_estimating_set<juliet::quadratic_julia_set>);
+
+    static_assert(juliet::accumulating_set<juliet::mandelbrot_set_t>);
+    static_assert(juliet::accumulating_set<juliet::quadratic_julia_set>);
+    static_assert(juliet::accumulating_set<juliet::burning_ship_set_t>);
+
+    namespace test {
+
+        /* NOTE: A rectangle across the boundaries of our escape-time sets, with room to escape on every side. */
+        constexpr inline auto sample_min = juliet::complex{-2.0_scalar, -1.25_scalar};
+        constexpr inline auto sample_max = juliet::complex{ 1.0_scalar,  1.25_scalar};
+
+        /* NOTE: Not a multiple of any batch width, so that the last batch is only partly filled. */
+        constexpr inline std::size_t sample_columns = 9;
+        constexpr inline std::size_t sample_rows    = 7;
+
+        /* A grid of numbers across the rectangle between 'min' and 'max', row by row like the pixels of a frame. */
+        template<typename Scalar>
+        consteval auto sample_numbers(const juliet::complex min = test::sample_min, const juliet::complex max = test::sample_max) {
+            auto nums = std::array<juliet::complex_for<Scalar>, test::sample_columns * test::sample_rows>{};
+
+            for (const auto y : std::views::iota(0uz, test::sample_rows)) {
+                for (const auto x : std::views::iota(0uz, test::sample_columns)) {
+                    const auto t_real = static_cast<juliet::scalar>(x) / static_cast<juliet::scalar>(test::sample_columns - 1);
+                    const auto t_imag = static_cast<juliet::scalar>(y) / static_cast<juliet::scalar>(test::sample_rows    - 1);
+
+                    nums[y * test::sample_columns + x] = juliet::complex_cast<Scalar>(juliet::complex{
+                        min.real() + t_real * (max.real() - min.real()),
+                        min.imag() + t_imag * (max.imag() - min.imag())
+                    });
+                }
+            }
+
+            return nums;
+        }
+
+        /* The numbers of 'sample_numbers' cut into batches, with the last padded out the same as renderers pad it. */
+        template<typename Scalar, std::size_t Width = juliet::batch_width_for<Scalar>>
+        consteval auto sample_batches(const juliet::complex min = test::sample_min, const juliet::complex max = test::sample_max) {
+            static constexpr auto NumSamples = test::sample_columns * test::sample_rows;
+
+            const auto nums = test::sample_numbers<Scalar>(min, max);
+
+            auto batches = std::array<juliet::complex_batch<Width, Scalar>, (NumSamples + Width - 1) / Width>{};
+            for (const auto i : std::views::iota(0uz, NumSamples)) {
+                batches[i / Width].store(i % Width, nums[i]);
+            }
+
+            auto &last = batches.back();
+
+            last.num_filled = NumSamples - (batches.size() - 1) * Width;
+            for (const auto i : std::views::iota(last.num_filled, Width)) {
+                last.store(i, last[0]);
+            }
+
+            return batches;
+        }
+
+        /*
+            Whether a batch path gives the same as a scalar path for
+            each number of 'sample_batches'. 'batch' is handed each
+            batch and returns a result for each of its lanes, and
+            'scalar' is handed each number alone.
+
+            NOTE: Padded lanes have no number of their own to check.
+        */
+        template<typename Scalar, std::size_t Width = juliet::batch_width_for<Scalar>>
+        consteval bool batch_matches_scalar(
+            const auto &batch,
+            const auto &scalar,
+
+            const juliet::complex min = test::sample_min,
+            const juliet::complex max = test::sample_max
+        ) {
+            for (const auto &nums : test::sample_batches<Scalar, Width>(min, max)) {
+                const auto results = batch(nums);
+
+                for (const auto i : std::views::iota(0uz, nums.num_filled)) {
+                    if (results[i] != scalar(nums[i])) {
+                        return false;
+                    }
+                }
+            }
+
+            return true;
+        }
+
+        template<std::size_t MaxIterations>
+        consteval bool iterations_batch_matches_scalar(
+            const juliet::iterative_set auto &set,
+
+            const juliet::complex min = test::sample_min,
+            const juliet::complex max = test::sample_max
+        ) {
+            return test::batch_matches_scalar<juliet::set_scalar<decltype(set)>>(
+                [&](const auto &nums) {
+                    return juliet::batch_iterations_before_escape<MaxIterations>(set, nums);
+                },
+
+                [&](const auto &num) {
+                    return set.template iterations_before_escape<MaxIterations>(num);
+                },
+
+                min,
+                max
+            );
+        }
+
+        /* Whether a set gives the same iterations as another set, through both of their batch and scalar paths. */
+        template<std::size_t MaxIterations>
+        consteval bool iterates_like(const juliet::iterative_set auto &set, const juliet::iterative_set auto &expected_set) {
+            using Scalar = juliet::set_scalar<decltype(set)>;
+
+            return (
+                test::batch_matches_scalar<Scalar>(
+                    [&](const auto &nums) {
+                        return juliet::batch_iterations_before_escape<MaxIterations>(set, nums);
+                    },
+
+                    [&](const auto &num) {
+                        return expected_set.template iterations_before_escape<MaxIterations>(num);
+                    }
+                ) &&
+
+                test::batch_matches_scalar<Scalar>(
+                    [&](const auto &nums) {
+                        return juliet::batch_iterations_before_escape<MaxIterations>(expected_set, nums);
+                    },
+
+                    [&](const auto &num) {
+                        return set.template iterations_before_escape<MaxIterations>(num);
+                    }
+                )
+            );
+        }
+
+        struct unchecked_mandelbrot_set: juliet::mandelbrot_set_t {
+            static constexpr bool reject_interior_regions = false;
+        };
+
+        static_assert(iterations_batch_matches_scalar<100>(juliet::mandelbrot_set_t{}));
+        static_assert(iterations_batch_matches_scalar<100>(unchecked_mandelbrot_set{}));
+        static_assert(iterations_batch_matches_scalar<100>(juliet::quadratic_julia_set{{-0.8_scalar, 0.156_scalar}}));
+
+        static_assert(iterations_batch_matches_scalar<100>(juliet::mandelbrot_set_for<std::float32_t>{}));
+        static_assert(iterations_batch_matches_scalar<100>(juliet::quadratic_julia_set{{-0.8_scalar, 0.156_scalar}}.with_scalar<std::float32_t>()));
+
+        static_assert(iterations_batch_matches_scalar<100>(juliet::mandelbrot_set_for<juliet::double_double>{}));
+
+        static_assert(
+            juliet::mandelbrot_set_for<juliet::double_double>{}.iterations_before_escape<100>(juliet::complex_for<juliet::double_double>{0.3_scalar, 0.0_scalar}) ==
+
+            juliet::mandelbrot_set.iterations_before_escape<100>(juliet::complex{0.3_scalar, 0.0_scalar})
+        );
+
+        static_assert(iterations_batch_matches_scalar<100>(juliet::mandelbrot_set_for<juliet::fixed_point>{}));
+        static_assert(iterations_batch_matches_scalar<100>(juliet::quadratic_julia_set{{-0.8_scalar, 0.156_scalar}}.with_scalar<juliet::fixed_point>()));
+
+        static_assert(
+            juliet::mandelbrot_set_for<juliet::fixed_point>{}.iterations_before_escape<100>(juliet::complex_for<juliet::fixed_point>{0.3_scalar, 0.0_scalar}) ==
+
+            juliet::mandelbrot_set.iterations_before_escape<100>(juliet::complex{0.3_scalar, 0.0_scalar})
+        );
+
+        /* NOTE: A degree of 2 should give exactly the same orbits as our quadratic sets. */
+        static_assert(iterates_like<100>(juliet::multibrot_set<2>, unchecked_mandelbrot_set{}));
+        static_assert(iterates_like<100>(juliet::multi_julia_set<2>{{-0.8_scalar, 0.156_scalar}}, juliet::quadratic_julia_set{{-0.8_scalar, 0.156_scalar}}));
+
+        /* NOTE: Every power is built from squares and products, so these cover each way of unrolling them. */
+        static_assert(iterations_batch_matches_scalar<100>(juliet::multibrot_set<3>));
+        static_assert(iterations_batch_matches_scalar<100>(juliet::multibrot_set<4>));
+        static_assert(iterations_batch_matches_scalar<100>(juliet::multibrot_set<7>));
+        static_assert(iterations_batch_matches_scalar<100>(juliet::multibrot_set<8>));
+        static_assert(iterations_batch_matches_scalar<100>(juliet::multibrot_set_for<5, std::float32_t>{}));
+        static_assert(iterations_batch_matches_scalar<100>(juliet::multi_julia_set<3>{{0.4_scalar, 0.0_scalar}}));
+        static_assert(iterations_batch_matches_scalar<100>(juliet::multi_julia_set<6>{{-0.8_scalar, 0.156_scalar}}.with_scalar<std::float32_t>()));
+        static_assert(iterations_batch_matches_scalar<100>(juliet::multibrot_set_for<3, juliet::double_double>{}));
+
+        /* NOTE: For the cubic Multibrot set, the orbit of 'i' cycles between zero and 'i', while that of '1.2i' escapes. */
+        static_assert(juliet::multibrot_set<3>.iterations_before_escape<100>(juliet::complex{0.0_scalar, 1.0_scalar}) == 100);
+        static_assert(juliet::multibrot_set<3>.iterations_before_escape<100>(juliet::complex{0.0_scalar, 1.2_scalar}) <  100);
+
+        /* NOTE: These reach further left and down than the Mandelbrot set does, with the Burning Ship's spire at about '-1.75 - 0.03i'. */
+        constexpr inline auto ship_sample_min = juliet::complex{-2.5_scalar, -2.0_scalar};
+        constexpr inline auto ship_sample_max = juliet::complex{ 1.5_scalar,  1.0_scalar};
+
+        static_assert(iterations_batch_matches_scalar<100>(juliet::burning_ship_set, ship_sample_min, ship_sample_max));
+        static_assert(iterations_batch_matches_scalar<100>(juliet::tricorn_set,      ship_sample_min, ship_sample_max));
+        static_assert(iterations_batch_matches_scalar<100>(juliet::celtic_set,       ship_sample_min, ship_sample_max));
+
+        static_assert(iterations_batch_matches_scalar<100>(juliet::burning_ship_set_for<std::float32_t>{}, ship_sample_min, ship_sample_max));
+        static_assert(iterations_batch_matches_scalar<100>(juliet::tricorn_set_for<std::float32_t>{},      ship_sample_min, ship_sample_max));
+        static_assert(iterations_batch_matches_scalar<100>(juliet::celtic_set_for<std::float32_t>{},       ship_sample_min, ship_sample_max));
+
+        static_assert(iterations_batch_matches_scalar<100>(juliet::burning_ship_set_for<juliet::double_double>{}, ship_sample_min, ship_sample_max));
+        static_assert(iterations_batch_matches_scalar<100>(juliet::celtic_set_for<juliet::double_double>{},       ship_sample_min, ship_sample_max));
+
+        /* NOTE: On the real axis, absolute values and conjugates change nothing, and so these all agree with the Mandelbrot set there. */
+        static_assert([]() {
+            const auto num = juliet::complex{0.3_scalar, 0.0_scalar};
+
+            const auto expected = juliet::mandelbrot_set.iterations_before_escape<100>(num);
+
+            return (
+                juliet::burning_ship_set.iterations_before_escape<100>(num) == expected &&
+                juliet::tricorn_set.iterations_before_escape<100>(num)      == expected &&
+                juliet::celtic_set.iterations_before_escape<100>(num)       == expected
+            );
+        }());
+
+        /* NOTE: The Tricorn is symmetric about the real axis. */
+        static_assert(
+            juliet::tricorn_set.iterations_before_escape<100>(juliet::complex{-0.2_scalar, 0.9_scalar}) ==
+
+            juliet::tricorn_set.iterations_before_escape<100>(juliet::complex{-0.2_scalar, -0.9_scalar})
+        );
+
+        /*
+            NOTE: We hand over more numbers than there are lanes, and not a multiple
+            of them, so that lanes get refilled and then left idle. The last,
+            partly filled batch has fewer numbers than lanes, and so some lanes
+            are never filled at all.
+        */
+        template<std::size_t MaxIterations>
+        consteval bool interleaved_matches_scalar(const juliet::interleaved_iterative_set auto &set) {
+            using Scalar = juliet::set_scalar<decltype(set)>;
+
+            static constexpr auto NumPoints = 3 * juliet::interleaved_lanes + 5;
+
+            return test::batch_matches_scalar<Scalar, NumPoints>(
+                [&](const auto &nums) {
+                    auto numbers = std::array<juliet::complex_for<Scalar>, NumPoints>{};
+                    for (const auto i : std::views::iota(0uz, NumPoints)) {
+                        numbers[i] = nums[i];
+                    }
+
+                    auto iterations = juliet::iterations_batch<NumPoints>{};
+                    set.template interleaved_iterations_before_escape<MaxIterations>(
+                        std::span<const juliet::complex_for<Scalar>>(numbers).first(nums.num_filled),
+                        std::span(iterations).first(nums.num_filled)
+                    );
+
+                    return iterations;
+                },
+
+                [&](const auto &num) {
+                    return set.template iterations_before_escape<MaxIterations>(num);
+                }
+            );
+        }
+
+        static_assert(interleaved_matches_scalar<100>(juliet::mandelbrot_set_t{}));
+        static_assert(interleaved_matches_scalar<100>(unchecked_mandelbrot_set{}));
+        static_assert(interleaved_matches_scalar<100>(juliet::quadratic_julia_set{{-0.8_scalar, 0.156_scalar}}));
+        static_assert(interleaved_matches_scalar<100>(juliet::multibrot_set<3>));
+        static_assert(interleaved_matches_scalar<100>(juliet::multi_julia_set<4>{{0.4_scalar, 0.0_scalar}}));
+        static_assert(interleaved_matches_scalar<100>(juliet::burning_ship_set));
+        static_assert(interleaved_matches_scalar<100>(juliet::mandelbrot_set_for<juliet::double_double>{}));
+        static_assert(interleaved_matches_scalar<100>(juliet::quadratic_julia_set_for<juliet::fixed_point>{{-0.8_scalar, 0.156_scalar}}));
+        static_assert(interleaved_matches_scalar<0>(juliet::mandelbrot_set_t{}));
+        static_assert(interleaved_matches_scalar<500>(juliet::quadratic_julia_set{{-1.0_scalar, 0.0_scalar}}.with_attracting_cycle()));
+        static_assert(interleaved_matches_scalar<500>(juliet::quadratic_julia_set_for<juliet::fixed_point>{{-1.0_scalar, 0.0_scalar}}.with_attracting_cycle()));
+
+        /* NOTE: Orbits drawn into an attracting cycle should stop once trapped, rather than being iterated to the end. */
+        static_assert([]() {
+            static constexpr auto MaxIterations = 500uz;
+            static constexpr auto NumPoints     = 2 * juliet::interleaved_lanes;
+
+            const auto constant = juliet::complex{-1.0_scalar, 0.0_scalar};
+
+            const auto count_steps = [&](const auto &periodicity) {
+                auto num_steps   = 0uz;
+                auto all_bounded = true;
+
+                impl::iterate_interleaved<MaxIterations, juliet::interleaved_lanes, juliet::scalar>(
+                    NumPoints,
+
+                    [&](const std::size_t index) -> std::optional<impl::orbit_start<juliet::scalar>> {
+                        return impl::orbit_start<juliet::scalar>{0.01_scalar * static_cast<juliet::scalar>(index), 0.0_scalar, constant.real(), constant.imag()};
+                    },
+
+                    [&](auto &real, auto &imag, const auto &real_sq, const auto &imag_sq, const auto &constant_real, const auto &constant_imag) {
+                        ++num_steps;
+
+                        impl::quadratic_step{}(real, imag, real_sq, imag_sq, constant_real, constant_imag);
+                    },
+
+                    [&](const std::size_t, const std::size_t iterations) {
+                        all_bounded = all_bounded && iterations == MaxIterations;
+                    },
+
+                    periodicity
+                );
+
+                return all_bounded ? num_steps : 0uz;
+            };
+
+            const auto plain_steps   = count_steps(juliet::no_periodicity_check{});
+            const auto trapped_steps = count_steps(juliet::attracting_cycle_check::for_constant(constant));
+
+            return trapped_steps > 0 && trapped_steps < plain_steps;
+        }());
+
+        /* NOTE: Sweeping the constant across lanes should give the same as each member of the family on its own. */
+        template<std::size_t MaxIterations>
+        consteval bool sweep_matches_members(const juliet::constant_family_set auto &set) {
+            using Scalar = juliet::set_scalar<decltype(set)>;
+
+            /* NOTE: Each number gets a constant of its own, so that every lane sweeps to a different member. */
+            const auto constant_for = [](const juliet::complex_for<Scalar> &num) {
+                return juliet::complex_for<Scalar>{num.imag() - static_cast<Scalar>(0.8_scalar), num.real() * static_cast<Scalar>(0.25_scalar)};
+            };
+
+            return test::batch_matches_scalar<Scalar>(
+                [&](const auto &nums) {
+                    auto constants = nums;
+                    for (const auto i : std::views::iota(0uz, constants.real.size())) {
+                        constants.store(i, constant_for(nums[i]));
+                    }
+
+                    return juliet::batch_iterations_before_escape<MaxIterations>(set, nums, constants);
+                },
+
+                [&](const auto &num) {
+                    auto member = set;
+                    member.constant = constant_for(num);
+
+                    return member.template iterations_before_escape<MaxIterations>(num);
+                }
+            );
+        }
+
+        static_assert(sweep_matches_members<100>(juliet::quadratic_julia_set{}));
+        static_assert(sweep_matches_members<100>(juliet::quadratic_julia_set_for<std::float32_t>{}));
+        static_assert(sweep_matches_members<100>(juliet::quadratic_julia_set_for<juliet::double_double>{}));
+        static_assert(sweep_matches_members<100>(juliet::multi_julia_set<3>{}));
+
+        static_assert(!juliet::constant_family_set<juliet::mandelbrot_set_t>);
+
+        static_assert(juliet::attracting_cycle_check::for_constant({0.0_scalar, 0.0_scalar}).period == 1);
+        static_assert(juliet::attracting_cycle_check::for_constant({-1.0_scalar, 0.0_scalar}).period == 2);
+        static_assert(juliet::attracting_cycle_check::for_constant({-0.12_scalar, 0.75_scalar}).period == 3);
+        static_assert(juliet::attracting_cycle_check::for_constant({0.3_scalar, 0.0_scalar}).period == 0);
+
+        /* NOTE: Constants on the boundary of a component have neutral cycles, which don't attract anything within any radius. */
+        static_assert(juliet::attracting_cycle_check::for_constant({-0.75_scalar, 0.0_scalar}).period == 0);
+
+        /* NOTE: Trapping orbits should only ever save iterations, and never change them. */
+        template<std::size_t MaxIterations>
+        consteval bool trapping_matches_plain(const juliet::complex constant) {
+            const auto plain   = juliet::quadratic_julia_set{constant};
+            const auto trapped = plain.with_attracting_cycle();
+
+            return (
+                test::iterations_batch_matches_scalar<MaxIterations>(trapped) &&
+
+                test::batch_matches_scalar<juliet::scalar>(
+                    [&](const auto &nums) {
+                        return juliet::batch_iterations_before_escape<MaxIterations>(trapped, nums);
+                    },
+
+                    [&](const auto &num) {
+                        return plain.iterations_before_escape<MaxIterations>(num);
+                    }
+                )
+            );
+        }
+
+        static_assert(trapping_matches_plain<500>({-1.0_scalar, 0.0_scalar}));
+        static_assert(trapping_matches_plain<500>({-0.12_scalar, 0.75_scalar}));
+        static_assert(trapping_matches_plain<500>({-0.8_scalar, 0.156_scalar}));
+        static_assert(trapping_matches_plain<500>({-1.0_scalar, 0.2_scalar}));
+
+        static_assert(juliet::quadratic_julia_set{{-1.0_scalar, 0.0_scalar}}.with_attracting_cycle().periodicity.period == 2);
+        static_assert(juliet::quadratic_julia_set_for<juliet::fixed_point>{{-1.0_scalar, 0.0_scalar}}.with_attracting_cycle().periodicity.period == 2);
+        static_assert(juliet::quadratic_julia_set_for<juliet::double_double>{{-1.0_scalar, 0.0_scalar}}.with_attracting_cycle().periodicity.period == 2);
+
+        /* NOTE: Single precision rounds orbits by more than our disks allow for. */
+        static_assert(juliet::quadratic_julia_set_for<std::float32_t>{{-1.0_scalar, 0.0_scalar}}.with_attracting_cycle().periodicity.period == 0);
+
+        /* NOTE: Sweeping must not use the traps found for the set's own constant. */
+        static_assert([]() {
+            const auto plain   = juliet::quadratic_julia_set{{-1.0_scalar, 0.0_scalar}};
+            const auto trapped = plain.with_attracting_cycle();
+
+            const auto constant_for = [](const juliet::complex &num) {
+                return juliet::complex{0.3_scalar, num.imag()};
+            };
+
+            return test::batch_matches_scalar<juliet::scalar>(
+                [&](const auto &nums) {
+                    auto constants = nums;
+                    for (const auto i : std::views::iota(0uz, constants.real.size())) {
+                        constants.store(i, constant_for(nums[i]));
+                    }
+
+                    return juliet::batch_iterations_before_escape<100>(trapped, nums, constants);
+                },
+
+                [&](const auto &num) {
+                    return juliet::quadratic_julia_set{constant_for(num)}.iterations_before_escape<100>(num);
+                }
+            );
+        }());
+
+        static_assert(!juliet::interleaved_iterative_set<juliet::basic_mandelbrot_set<juliet::periodicity_check>>);
+
+        static_assert([]() {
+            const auto values = simd::abs(simd::vector<juliet::scalar, 4>{-1.0_scalar, 2.0_scalar, -0.0_scalar, -3.5_scalar});
+
+            return values[0] == 1.0_scalar && values[1] == 2.0_scalar && values[2] == 0.0_scalar && values[3] == 3.5_scalar;
+        }());
+
+        static_assert(simd::abs(juliet::double_double{-2.0_scalar}) == juliet::double_double{2.0_scalar});
+
+        /* NOTE: Traced orbits should escape exactly when they otherwise would, with a value for every iteration before then. */
+        static_assert(std::ranges::all_of(test::sample_numbers<juliet::scalar>(), [](const juliet::complex &num) {
+            auto num_values = 0uz;
+
+            const auto iterations = juliet::mandelbrot_set.trace_orbit<100>(num, [&](const juliet::complex &) {
+                ++num_values;
+            });
+
+            return iterations == unchecked_mandelbrot_set{}.iterations_before_escape<100>(num) && num_values == iterations;
+        }));
+
+        struct test_frame {
+            juliet::scalar pixel_scale;
+        };
+
+        static_assert(iterations_batch_matches_scalar<100>(
+            juliet::basic_mandelbrot_set<juliet::periodicity_check>{}.for_frame(test_frame{0.01_scalar}, 100)
+        ));
+
+        static_assert(iterations_batch_matches_scalar<100>(
+            juliet::basic_quadratic_julia_set<juliet::periodicity_check>{{-0.8_scalar, 0.156_scalar}}.for_frame(test_frame{0.01_scalar}, 100)
+        ));
+
+        /* Orbits which were stopped and then continued should escape exactly when they would have otherwise. */
+        template<std::size_t FirstMaxIterations, std::size_t MaxIterations>
+        consteval bool continuing_matches_restarting(const juliet::resumable_set auto &set) {
+            using Scalar = juliet::set_scalar<decltype(set)>;
+
+            const auto initial_values = [&](const auto &nums) {
+                auto values = nums;
+                for (const auto i : std::views::iota(0uz, nums.real.size())) {
+                    values.store(i, set.initial_orbit_value(nums[i]));
+                }
+
+                return values;
+            };
+
+            const auto stopped_batch = [&](const auto &nums) {
+                auto values = initial_values(nums);
+
+                return juliet::batch_continue_orbits<FirstMaxIterations>(set, nums, values, 0uz);
+            };
+
+            const auto stopped_scalar = [&](const auto &num) {
+                auto value = set.initial_orbit_value(num);
+
+                return set.template continue_orbit<FirstMaxIterations>(num, value, 0uz);
+            };
+
+            /* NOTE: Only the orbits which hadn't escaped yet are continued, as when rendering. */
+            const auto continued_batch = [&](const auto &nums) {
+                auto values = initial_values(nums);
+
+                auto iterations = juliet::batch_continue_orbits<FirstMaxIterations>(set, nums, values, 0uz);
+
+                const auto continued = juliet::batch_continue_orbits<MaxIterations>(set, nums, values, FirstMaxIterations);
+                for (const auto i : std::views::iota(0uz, iterations.size())) {
+                    if (iterations[i] == FirstMaxIterations) {
+                        iterations[i] = continued[i];
+                    }
+                }
+
+                return iterations;
+            };
+
+            const auto continued_scalar = [&](const auto &num) {
+                auto value = set.initial_orbit_value(num);
+
+                const auto iterations = set.template continue_orbit<FirstMaxIterations>(num, value, 0uz);
+                if (iterations < FirstMaxIterations) {
+                    return iterations;
+                }
+
+                return set.template continue_orbit<MaxIterations>(num, value, FirstMaxIterations);
+            };
+
+            const auto restarted = [&](const auto &num) {
+                return set.template iterations_before_escape<MaxIterations>(num);
+            };
+
+            return (
+                test::batch_matches_scalar<Scalar>(stopped_batch,   stopped_scalar)   &&
+                test::batch_matches_scalar<Scalar>(continued_batch, continued_scalar) &&
+                test::batch_matches_scalar<Scalar>(continued_batch, restarted)
+            );
+        }
+
+        static_assert(continuing_matches_restarting<20, 100>(juliet::mandelbrot_set_t{}));
+        static_assert(continuing_matches_restarting<20, 100>(unchecked_mandelbrot_set{}));
+        static_assert(continuing_matches_restarting<20, 100>(juliet::quadratic_julia_set{{-0.8_scalar, 0.156_scalar}}));
+        static_assert(continuing_matches_restarting<20, 100>(juliet::mandelbrot_set_for<juliet::double_double>{}));
+        static_assert(continuing_matches_restarting<20, 100>(juliet::multibrot_set<5>));
+        static_assert(continuing_matches_restarting<20, 100>(juliet::burning_ship_set));
+
+        template<std::size_t MaxIterations>
+        consteval bool smooth_batch_matches_scalar(const juliet::smooth_iterative_set auto &set) {
+            using Scalar = juliet::set_scalar<decltype(set)>;
+
+            const auto smooth = [&](const auto &num) {
+                return set.template smooth_iterations_before_escape<MaxIterations>(num);
+            };
+
+            /* NOTE: Smoothing should keep the same iterations, and its fraction should never reach the next iteration. */
+            const auto only_adds_fraction = [&](const auto &num) {
+                const auto escape = smooth(num);
+
+                return (
+                    escape.iterations == set.template iterations_before_escape<MaxIterations>(num) &&
+
+                    (escape.iterations >= MaxIterations || escape.smooth_iterations < static_cast<juliet::scalar>(escape.iterations + 1))
+                );
+            };
+
+            return (
+                test::batch_matches_scalar<Scalar>(
+                    [&](const auto &nums) {
+                        return juliet::batch_smooth_iterations_before_escape<MaxIterations>(set, nums);
+                    },
+
+                    smooth
+                ) &&
+
+                std::ranges::all_of(test::sample_numbers<Scalar>(), only_adds_fraction)
+            );
+        }
+
+        static_assert(smooth_batch_matches_scalar<100>(juliet::mandelbrot_set_t{}));
+        static_assert(smooth_batch_matches_scalar<100>(juliet::quadratic_julia_set{{-0.8_scalar, 0.156_scalar}}));
+        static_assert(smooth_batch_matches_scalar<100>(juliet::mandelbrot_set_for<std::float32_t>{}));
+
+        template<std::size_t MaxIterations>
+        consteval bool distance_batch_matches_scalar(const juliet::distance_estimating_set auto &set) {
+            using Scalar = juliet::set_scalar<decltype(set)>;
+
+            const auto estimate = [&](const auto &num) {
+                return set.template estimate_distance<MaxIterations>(num);
+            };
+
+            /* NOTE: Estimating should keep the same iterations, and give every escaped number some distance. */
+            const auto estimates_escaped = [&](const auto &num) {
+                const auto distance = estimate(num);
+
+                return (
+                    distance.iterations == set.template iterations_before_escape<MaxIterations>(num) &&
+
+                    (distance.iterations >= MaxIterations || distance.distance > 0.0_scalar)
+                );
+            };
+
+            return (
+                test::batch_matches_scalar<Scalar>(
+                    [&](const auto &nums) {
+                        return juliet::batch_estimate_distances<MaxIterations>(set, nums);
+                    },
+
+                    estimate
+                ) &&
+
+                std::ranges::all_of(test::sample_numbers<Scalar>(), estimates_escaped)
+            );
+        }
+
+        static_assert(distance_batch_matches_scalar<100>(juliet::mandelbrot_set_t{}));
+        static_assert(distance_batch_matches_scalar<100>(unchecked_mandelbrot_set{}));
+        static_assert(distance_batch_matches_scalar<100>(juliet::quadratic_julia_set{{-0.8_scalar, 0.156_scalar}}));
+        static_assert(distance_batch_matches_scalar<100>(juliet::mandelbrot_set_for<std::float32_t>{}));
+        static_assert(distance_batch_matches_scalar<100>(juliet::mandelbrot_set_for<juliet::double_double>{}));
+
+        /* NOTE: The set ends at -2 on the real axis, and the estimate should be within a factor of four of how far away that is. */
+        static_assert([]() {
+            const auto estimate = juliet::mandelbrot_set.estimate_distance<100>(juliet::complex{-2.5_scalar, 0.0_scalar});
+
+            return estimate.distance >= 0.5_scalar && estimate.distance <= 4.0_scalar * 0.5_scalar;
+        }());
+
+        template<std::size_t MaxIterations>
+        consteval bool accumulate_batch_matches_scalar(const juliet::accumulating_set auto &set, const juliet::orbit_accumulator auto &accumulator) {
+            using Scalar = juliet::set_scalar<decltype(set)>;
+
+            const auto accumulate = [&](const auto &num) {
+                return set.template accumulate_orbit<MaxIterations>(num, accumulator);
+            };
+
+            /* NOTE: Accumulating should never change when an orbit escapes. */
+            const auto escapes_as_usual = [&](const juliet::complex_for<Scalar> &num) {
+                return accumulate(num).iterations == set.template iterations_before_escape<MaxIterations>(num);
+            };
+
+            return (
+                test::batch_matches_scalar<Scalar>(
+                    [&](const auto &nums) {
+                        return juliet::batch_accumulate_orbits<MaxIterations>(set, nums, accumulator);
+                    },
+
+                    accumulate
+                ) &&
+
+                std::ranges::all_of(test::sample_numbers<Scalar>(), escapes_as_usual)
+            );
+        }
+
+        static_assert(accumulate_batch_matches_scalar<100>(juliet::mandelbrot_set_t{}, juliet::no_orbit_accumulator{}));
+        static_assert(accumulate_batch_matches_scalar<100>(juliet::mandelbrot_set_t{}, juliet::point_trap{}));
+        static_assert(accumulate_batch_matches_scalar<100>(juliet::mandelbrot_set_t{}, juliet::line_trap{{}, {1.0_scalar, 1.0_scalar}}));
+        static_assert(accumulate_batch_matches_scalar<100>(juliet::mandelbrot_set_t{}, juliet::stripe_average<>{}));
+        static_assert(accumulate_batch_matches_scalar<100>(juliet::mandelbrot_set_t{}, juliet::magnitude_range{}));
+        static_assert(accumulate_batch_matches_scalar<100>(juliet::mandelbrot_set_for<std::float32_t>{}, juliet::magnitude_range{}));
+        static_assert(accumulate_batch_matches_scalar<100>(juliet::quadratic_julia_set{{-0.8_scalar, 0.156_scalar}}, juliet::stripe_average<6>{}));
+        static_assert(accumulate_batch_matches_scalar<100>(juliet::burning_ship_set, juliet::point_trap{{-0.5_scalar, 0.0_scalar}}));
+
+        /* NOTE: The orbit of -2 goes straight to 2 and stays there. */
+        static_assert(juliet::mandelbrot_set.accumulate_orbit<100>(juliet::complex{-2.0_scalar, 0.0_scalar}, juliet::magnitude_range{}).outputs == std::array{2.0_scalar, 2.0_scalar});
+
+        /* NOTE: The orbit of 0 never leaves it. */
+        static_assert(juliet::mandelbrot_set.accumulate_orbit<100>(juliet::complex{}, juliet::point_trap{}) == juliet::accumulated_orbit<1>{100, {0.0_scalar}});
+
+        /* NOTE: The orbit of 2.5 escapes with its first value, which isn't counted. */
+        static_assert(juliet::mandelbrot_set.accumulate_orbit<100>(juliet::complex{2.5_scalar, 0.0_scalar}, juliet::stripe_average<>{}) == juliet::accumulated_orbit<1>{0, {0.0_scalar}});
+
+    }
 
 }
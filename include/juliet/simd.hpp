@@ -0,0 +1,404 @@
+#pragma once
+
+#include <juliet/common.hpp>
+
+namespace juliet::simd {
+
+    namespace impl {
+
+        template<typename T>
+        struct builtin_element;
+
+        template<>
+        struct builtin_element<std::float32_t> {
+            using type = float;
+        };
+
+        template<>
+        struct builtin_element<std::float64_t> {
+            using type = double;
+        };
+
+    }
+
+    /*
+        NOTE: GCC's vector extensions want the builtin
+        floating-point types and not the ones from '<stdfloat>',
+        so we map our scalars onto those for our lanes.
+    */
+    template<typename T>
+    using element = typename impl::builtin_element<T>::type;
+
+    template<typename T>
+    concept vectorizable = requires {
+        typename simd::element<T>;
+    };
+
+    /* The size in bytes of the widest vector registers we're compiled for. */
+    constexpr inline std::size_t native_register_size = []() -> std::size_t {
+        #if defined(__AVX512F__)
+            return 64;
+        #elif defined(__AVX__)
+            return 32;
+        #else
+            return 16;
+        #endif
+    }();
+
+    /*
+        NOTE: The instruction sets we compile our kernels for.
+
+        The baseline is whatever we were compiled for, and the
+        others are compiled alongside it in the same binary,
+        with the best supported one being picked at startup.
+    */
+    enum class isa {
+        baseline,
+        avx2,
+        avx512,
+    };
+
+    constexpr inline bool can_target_x86 = []() {
+        #if defined(__x86_64__) || defined(__i386__)
+            return true;
+        #else
+            return false;
+        #endif
+    }();
+
+    constexpr inline simd::isa widest_isa = []() {
+        if constexpr (simd::can_target_x86) {
+            return simd::isa::avx512;
+        } else {
+            return simd::isa::baseline;
+        }
+    }();
+
+    template<simd::isa Isa>
+    constexpr inline std::size_t register_size = []() -> std::size_t {
+        if constexpr (Isa == simd::isa::avx512) {
+            return 64;
+        } else if constexpr (Isa == simd::isa::avx2) {
+            return std::max(simd::native_register_size, 32uz);
+        } else {
+            return simd::native_register_size;
+        }
+    }();
+
+    template<simd::isa Isa, simd::vectorizable T>
+    constexpr inline std::size_t width = simd::register_size<Isa> / sizeof(simd::element<T>);
+
+    template<simd::vectorizable T, std::size_t Width>
+    requires (std::has_single_bit(Width))
+    using vector [[gnu::vector_size(sizeof(simd::element<T>) * Width)]] = simd::element<T>;
+
+    /* NOTE: Comparing vectors gives us a vector of same-sized integers, all bits set for true lanes. */
+    template<typename Vector>
+    using mask_for = decltype(std::declval<Vector>() < std::declval<Vector>());
+
+    template<typename Vector>
+    constexpr inline std::size_t width_of = sizeof(Vector) / sizeof(std::declval<Vector>()[0]);
+
+    /*
+        NOTE: Writing to individual lanes isn't allowed in
+        constant evaluation, so these helpers make sure to
+        only ever build whole vectors at once.
+    */
+
+    /* NOTE: Also accepts plain scalars, so that kernels can be written once for both. */
+    template<typename Vector>
+    [[gnu::always_inline]]
+    constexpr Vector broadcast(const auto value) {
+        if constexpr (!requires(const Vector vector) { vector[0]; }) {
+            return static_cast<Vector>(value);
+        } else {
+            using Element = std::remove_cvref_t<decltype(std::declval<Vector>()[0])>;
+
+            /* NOTE: Mixing a vector with a scalar splats the scalar across all lanes. */
+            return Vector{} + static_cast<Element>(value);
+        }
+    }
+
+    template<typename Vector, typename T, std::size_t Width>
+    requires (simd::width_of<Vector> == Width)
+    [[gnu::always_inline]]
+    constexpr Vector load(const std::array<T, Width> &values) {
+        return std::bit_cast<Vector>(values);
+    }
+
+    /* Loads the lanes starting at 'offset' of a larger array. */
+    template<typename Vector, typename T, std::size_t Size>
+    requires (simd::width_of<Vector> <= Size)
+    [[gnu::always_inline]]
+    constexpr Vector load(const std::array<T, Size> &values, const std::size_t offset) {
+        auto lanes = std::array<T, simd::width_of<Vector>>{};
+
+        for (const auto i : std::views::iota(0uz, lanes.size())) {
+            lanes[i] = values[offset + i];
+        }
+
+        return simd::load<Vector>(lanes);
+    }
+
+    template<typename T, typename Vector>
+    [[gnu::always_inline]]
+    constexpr std::array<T, simd::width_of<Vector>> store(const Vector vector) {
+        auto values = std::array<T, simd::width_of<Vector>>{};
+
+        for (const auto i : std::views::iota(0uz, values.size())) {
+            values[i] = static_cast<T>(vector[i]);
+        }
+
+        return values;
+    }
+
+    template<typename Mask>
+    [[gnu::always_inline]]
+    constexpr bool any(const Mask mask) {
+        if constexpr (std::same_as<Mask, bool>) {
+            return mask;
+        } else {
+            /* NOTE: We don't exit early so that this can stay branchless. */
+            auto combined = std::remove_cvref_t<decltype(mask[0])>{};
+
+            for (const auto i : std::views::iota(0uz, simd::width_of<Mask>)) {
+                combined |= mask[i];
+            }
+
+            return combined != 0;
+        }
+    }
+
+    /* NOTE: Also accepts plain scalars, like 'broadcast'. */
+    template<typename Value>
+    [[gnu::always_inline]]
+    constexpr Value abs(const Value &value) {
+        if constexpr (!requires { value[0]; }) {
+            using std::abs;
+
+            return abs(value);
+        } else {
+            using Mask    = simd::mask_for<Value>;
+            using Element = std::remove_cvref_t<decltype(std::declval<Mask>()[0])>;
+
+            /* NOTE: Clearing the sign bits is a single 'and', where comparing and negating would take several instructions. */
+            const auto magnitude_bits = simd::broadcast<Mask>(std::numeric_limits<Element>::max());
+
+            return std::bit_cast<Value>(std::bit_cast<Mask>(value) & magnitude_bits);
+        }
+    }
+
+    namespace impl {
+
+        /* NOTE: The type of each lane and the same-sized integers for its bits, for plain scalars or for vectors. */
+        template<typename Value>
+        struct lanes_of {
+            using element = Value;
+            using bits    = std::conditional_t<sizeof(Value) == 4, std::int32_t, std::int64_t>;
+        };
+
+        template<typename Value>
+        requires requires(const Value value) { value[0]; }
+        struct lanes_of<Value> {
+            using element = std::remove_cvref_t<decltype(std::declval<Value>()[0])>;
+            using bits    = simd::mask_for<Value>;
+        };
+
+    }
+
+    /*
+        An approximation of 'log2', to within about 1e-7 for
+        doubles, for plain scalars or for each lane of vectors.
+
+        NOTE: The exponent is read straight from the bits, and the
+        mantissa is moved into '[sqrt(1/2), sqrt(2))', where a short
+        series for 'atanh' converges quickly. Zero gives '-inf', and
+        infinities and NaNs give NaN, as neither has bits we can read
+        a logarithm from. Subnormals come out as large negative numbers
+        rather than their true logarithms, and negative numbers aren't
+        handled at all.
+    */
+    template<typename Value>
+    [[gnu::always_inline]]
+    constexpr Value fast_log2(const Value &value) {
+        using Element = typename impl::lanes_of<Value>::element;
+        using Bits    = typename impl::lanes_of<Value>::bits;
+        using Integer = std::conditional_t<sizeof(Element) == 4, std::int32_t, std::int64_t>;
+
+        static constexpr auto MantissaBits = std::numeric_limits<Element>::digits - 1;
+        static constexpr auto ExponentBias = Integer{std::numeric_limits<Element>::max_exponent - 1};
+
+        static constexpr auto MantissaMask = (Integer{1} << MantissaBits) - 1;
+        static constexpr auto OneBits      = ExponentBias << MantissaBits;
+
+        const auto bits = std::bit_cast<Bits>(value);
+
+        const auto exponent_bits = (bits >> MantissaBits) - simd::broadcast<Bits>(ExponentBias);
+
+        auto exponent = [&]() {
+            if constexpr (requires { value[0]; }) {
+                return __builtin_convertvector(exponent_bits, Value);
+            } else {
+                return static_cast<Value>(exponent_bits);
+            }
+        }();
+
+        auto mantissa = std::bit_cast<Value>((bits & simd::broadcast<Bits>(MantissaMask)) | simd::broadcast<Bits>(OneBits));
+
+        const auto high = (mantissa > simd::broadcast<Value>(std::numbers::sqrt2_v<Element>));
+
+        mantissa = high ? mantissa * simd::broadcast<Value>(0.5) : mantissa;
+        exponent = high ? exponent + simd::broadcast<Value>(1.0) : exponent;
+
+        const auto one = simd::broadcast<Value>(1.0);
+
+        const auto t    = (mantissa - one) / (mantissa + one);
+        const auto t_sq = t * t;
+
+        /* NOTE: 'log(m) = 2 atanh(t)', where 't = (m - 1) / (m + 1)', whose series only has odd powers. */
+        const auto series = t * (
+            one + t_sq * (
+                simd::broadcast<Value>(1.0 / 3.0) + t_sq * (
+                    simd::broadcast<Value>(1.0 / 5.0) + t_sq * simd::broadcast<Value>(1.0 / 7.0)
+                )
+            )
+        );
+
+        const auto result = exponent + series * simd::broadcast<Value>(2.0 / std::numbers::ln2_v<Element>);
+
+        /* NOTE: Comparisons with NaN are false, so NaNs are caught along with infinities. */
+        const auto finite = (value <= simd::broadcast<Value>(std::numeric_limits<Element>::max()));
+        const auto zero   = (value == simd::broadcast<Value>(0.0));
+
+        const auto finite_result = finite ? result : simd::broadcast<Value>(std::numeric_limits<Element>::quiet_NaN());
+
+        return zero ? simd::broadcast<Value>(-std::numeric_limits<Element>::infinity()) : finite_result;
+    }
+
+    inline bool supports(const simd::isa isa) {
+        #if defined(__x86_64__) || defined(__i386__)
+            /* NOTE: We may be called before constructors which would otherwise initialize this. */
+            __builtin_cpu_init();
+
+            switch (isa) {
+                case simd::isa::baseline: return true;
+
+                case simd::isa::avx2: {
+                    return __builtin_cpu_supports("avx2") && __builtin_cpu_supports("fma");
+                }
+
+                case simd::isa::avx512: {
+                    return simd::supports(simd::isa::avx2) && __builtin_cpu_supports("avx512f");
+                }
+            }
+
+            std::unreachable();
+        #else
+            return isa == simd::isa::baseline;
+        #endif
+    }
+
+    constexpr std::optional<simd::isa> isa_from_name(const std::string_view name) {
+        if (name == "baseline") {
+            return simd::isa::baseline;
+        }
+
+        if (name == "avx2") {
+            return simd::isa::avx2;
+        }
+
+        if (name == "avx512") {
+            return simd::isa::avx512;
+        }
+
+        return std::nullopt;
+    }
+
+    namespace impl {
+
+        inline simd::isa best_supported_isa() {
+            /*
+                NOTE: Setting the 'JULIET_SIMD_ISA' environment variable
+                to 'baseline', 'avx2', or 'avx512' forces that flavor
+                of our kernels, so long as the CPU supports it.
+            */
+            if (const char *forced_name = std::getenv("JULIET_SIMD_ISA"); forced_name != nullptr) {
+                const auto forced = simd::isa_from_name(forced_name);
+
+                if (forced.has_value() && simd::supports(*forced)) {
+                    return *forced;
+                }
+            }
+
+            for (const auto isa : {simd::isa::avx512, simd::isa::avx2}) {
+                if (simd::supports(isa)) {
+                    return isa;
+                }
+            }
+
+            return simd::isa::baseline;
+        }
+
+        inline auto selected_isa = std::atomic<simd::isa>(impl::best_supported_isa());
+
+        template<typename Function>
+        [[gnu::flatten]]
+        decltype(auto) run_as_baseline(Function &function) {
+            return function.template operator ()<simd::isa::baseline>();
+        }
+
+        #if defined(__x86_64__) || defined(__i386__)
+
+            /*
+                NOTE: Flattening inlines everything the kernel
+                calls into these functions, so that it all
+                gets compiled for their instruction set.
+            */
+
+            template<typename Function>
+            [[gnu::target("avx2,fma"), gnu::flatten]]
+            decltype(auto) run_as_avx2(Function &function) {
+                return function.template operator ()<simd::isa::avx2>();
+            }
+
+            template<typename Function>
+            [[gnu::target("avx512f,avx2,fma"), gnu::flatten]]
+            decltype(auto) run_as_avx512(Function &function) {
+                return function.template operator ()<simd::isa::avx512>();
+            }
+
+        #endif
+
+    }
+
+    inline simd::isa active_isa() {
+        return impl::selected_isa.load(std::memory_order_relaxed);
+    }
+
+    /* Returns whether the CPU supports the instruction set and so it was actually forced. */
+    inline bool force_isa(const simd::isa isa) {
+        if (!simd::supports(isa)) {
+            return false;
+        }
+
+        impl::selected_isa.store(isa, std::memory_order_relaxed);
+
+        return true;
+    }
+
+    /* Calls 'function.template operator ()<Isa>()' compiled for the active instruction set. */
+    template<typename Function>
+    decltype(auto) dispatch(Function &&function) {
+        #if defined(__x86_64__) || defined(__i386__)
+            switch (simd::active_isa()) {
+                case simd::isa::avx512: return impl::run_as_avx512(function);
+                case simd::isa::avx2:   return impl::run_as_avx2(function);
+
+                default: break;
+            }
+        #endif
+
+        return impl::run_as_baseline(function);
+    }
+
+}
@@ -4,8 +4,26 @@
 
 namespace juliet {
 
-    using scalar  = std::float64_t;
-    using complex = std::complex<juliet::scalar>;
+    using scalar = std::float64_t;
+
+    /*
+        NOTE: For scalars which aren't builtin floating-point
+        types, e.g. 'juliet::double_double', this relies on
+        the generic 'std::complex' template, of which we only
+        use the parts that are written in terms of arithmetic.
+    */
+    template<typename Scalar>
+    using complex_for = std::complex<Scalar>;
+
+    using complex = juliet::complex_for<juliet::scalar>;
+
+    namespace impl {
+
+        /* NOTE: '__extension__' keeps '-Wpedantic' from complaining about these. */
+        __extension__ using uint128 = unsigned __int128;
+        __extension__ using int128  = __int128;
+
+    }
 
     inline namespace literals {
 
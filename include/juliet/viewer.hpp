@@ -2,6 +2,7 @@
 
 #include <juliet/common.hpp>
 #include <juliet/sets.hpp>
+#include <juliet/perturbation.hpp>
 #include <juliet/rgb_renderer.hpp>
 #include <juliet/renderer_thread_pool.hpp>
 
@@ -92,6 +93,43 @@ namespace juliet {
             }
         }())::type;
 
+        /* NOTE: Such sets are rendered in whichever precision the frame needs, so we hold the frame in the most precise. */
+        static constexpr bool _is_rescalable = juliet::rescalable_set<set>;
+
+        using _frame_scalar = std::conditional_t<_is_rescalable, juliet::quad_double, juliet::set_scalar<set>>;
+
+        /* NOTE: Fixed-point sets are chosen for their reproducible results, which rescaling them would lose. */
+        static constexpr bool _is_rescaled = _is_rescalable && !std::same_as<juliet::set_scalar<set>, juliet::fixed_point>;
+
+        /* NOTE: Generated sets are replaced every update, so only static sets can keep a new origin. */
+        static constexpr bool _is_rebasable = _is_static_set && juliet::rebasable_set<set>;
+
+        using _initial_set_type = std::conditional_t<_is_rebasable, set, impl::empty_type>;
+
+        /* NOTE: Generated sets would be different by the time we continued them. */
+        static constexpr bool _is_resumable = _is_static_set && juliet::resumable_set<set>;
+
+        /*
+            NOTE: Orbits are kept in the scalar of the set which was
+            rendered, one of those 'juliet::with_scalar_for_frame'
+            chooses between, so that they take no more memory than
+            the render itself needed.
+        */
+        using _pending_orbits = std::conditional_t<
+            _is_rescaled,
+
+            std::variant<
+                juliet::pending_orbits<std::float32_t>,
+                juliet::pending_orbits<std::float64_t>,
+                juliet::pending_orbits<juliet::double_double>,
+                juliet::pending_orbits<juliet::quad_double>
+            >,
+
+            std::variant<juliet::pending_orbits<juliet::set_scalar<set>>>
+        >;
+
+        using _pending_type = std::conditional_t<_is_resumable, std::optional<_pending_orbits>, impl::empty_type>;
+
         static constexpr const char *save_location = "out.png";
 
         static constexpr juliet::coord high_res_scale = 6;
@@ -134,11 +172,20 @@ namespace juliet {
         [[no_unique_address]] set _set;
         [[no_unique_address]] _update_data _update_info;
 
+        /* NOTE: Kept so that resetting the frame can also undo any rebasing. */
+        [[no_unique_address]] _initial_set_type _initial_set;
+
         sf::RenderWindow _window;
 
-        juliet::rgba_renderer _renderer;
+        juliet::basic_rgba_renderer<_frame_scalar> _renderer;
         juliet::renderer_thread_pool _pool;
 
+        /* NOTE: The orbits which hadn't escaped in what's currently drawn, if it can still be continued. */
+        [[no_unique_address]] _pending_type _pending;
+
+        /* NOTE: Raised when asked to iterate further, and until the frame is reset we don't go below it. */
+        std::size_t _min_max_iterations = 0;
+
         bool _fine_controls = false;
 
         _translation_info _translation;
@@ -156,6 +203,7 @@ namespace juliet {
         requires (_is_static_set)
         :
             _set(std::move(set)),
+            _initial_set(_set),
             _window(sf::VideoMode({width, height}), title),
             _renderer(juliet::resolution{width, height}),
             _pool(num_threads)
@@ -209,36 +257,167 @@ namespace juliet {
         }
 
         void high_res_save(this viewer &self) {
+            self._rebase_if_needed();
+
             const auto frame = self._renderer.frame();
 
-            auto high_res_renderer = juliet::rgb_renderer(self.resolution().scale(high_res_scale), juliet::frame{
+            auto high_res_renderer = juliet::basic_rgb_renderer<_frame_scalar>(self.resolution().scale(high_res_scale), juliet::basic_frame<_frame_scalar>{
                 frame.center,
-                frame.pixel_scale / static_cast<juliet::scalar>(high_res_scale)
+                frame.pixel_scale / static_cast<_frame_scalar>(high_res_scale)
             });
 
-            self._pool.threaded_render_by_iteration(high_res_renderer, self._set);
+            high_res_renderer.set_max_iterations(juliet::auto_max_iterations(
+                self._absolute_pixel_scale(high_res_renderer.frame()),
+
+                high_res_renderer.resolution()
+            ));
+
+            self._with_set_for_frame(high_res_renderer.frame(), [&](const auto &set) {
+                self._pool.threaded_render_by_iteration(high_res_renderer, set);
+            });
 
             high_res_renderer.save_png(save_location);
         }
 
+        /* Hands the callback our set, in the cheapest precision which can still resolve the frame. */
+        void _with_set_for_frame(this const viewer &self, const juliet::basic_frame<_frame_scalar> &frame, const auto &callback) {
+            if constexpr (_is_rescaled) {
+                juliet::with_scalar_for_frame(frame, [&]<typename Scalar>() {
+                    callback(self._set.template with_scalar<Scalar>());
+                });
+            } else {
+                callback(self._set);
+            }
+        }
+
+        juliet::floatexp _absolute_pixel_scale(this const viewer &self, const juliet::basic_frame<_frame_scalar> &frame) {
+            if constexpr (_is_rebasable) {
+                return self._set.absolute_pixel_scale(frame);
+            } else {
+                return juliet::floatexp(static_cast<juliet::scalar>(frame.pixel_scale));
+            }
+        }
+
+        /* NOTE: Called whenever the frame or resolution changes, since the orbits no longer belong to what's drawn. */
+        void _discard_pending(this viewer &self) {
+            if constexpr (_is_resumable) {
+                self._pending.reset();
+            }
+        }
+
+        /* NOTE: We iterate more the further we zoom in. */
+        void _update_max_iterations(this viewer &self) {
+            const auto auto_max_iterations = juliet::auto_max_iterations(
+                self._absolute_pixel_scale(self._renderer.frame()),
+
+                self.resolution()
+            );
+
+            self._renderer.set_max_iterations(std::max(auto_max_iterations, self._min_max_iterations));
+        }
+
+        /*
+            Raises the max iterations to the next of those
+            precompiled, and continues the pixels which hadn't
+            escaped yet if what's drawn is still their frame.
+
+            Returns whether a new draw should be requested.
+        */
+        bool iterate_further(this viewer &self) {
+            self._min_max_iterations = 2 * self._renderer.rendered_max_iterations();
+
+            self._update_max_iterations();
+
+            if constexpr (_is_resumable) {
+                if (self._pending.has_value()) {
+                    auto continued = false;
+
+                    self._with_set_for_frame(self._renderer.frame(), [&](const auto &set) {
+                        /* NOTE: Orbits are discarded whenever the frame changes, so this should be the scalar they were kept in. */
+                        auto *pending = std::get_if<juliet::pending_orbits<juliet::set_scalar<decltype(set)>>>(&*self._pending);
+                        if (pending == nullptr) {
+                            return;
+                        }
+
+                        self._pool.threaded_continue_pending(self._renderer, set, *pending);
+
+                        continued = true;
+                    });
+
+                    if (continued) {
+                        self.update_window();
+
+                        return false;
+                    }
+                }
+            }
+
+            return true;
+        }
+
         void reset_frame(this viewer &self) {
+            if constexpr (_is_rebasable) {
+                self._set = self._initial_set;
+            }
+
+            self._min_max_iterations = 0;
+
             self._renderer.set_complete_frame();
+
+            self._discard_pending();
+        }
+
+        /*
+            Moves the set's origin to the frame's center once the
+            center is too far away for scalars to resolve pixels,
+            or the frame is zoomed in far enough that we should move
+            its pixel scale into the set before it underflows.
+        */
+        void _rebase_if_needed(this viewer &self) {
+            if constexpr (_is_rebasable) {
+                static constexpr auto MaxCenterDistanceInPixels = static_cast<juliet::scalar>(1uz << 20);
+
+                static constexpr auto MinPixelScale = std::numeric_limits<juliet::scalar>::epsilon() * std::numeric_limits<juliet::scalar>::epsilon();
+
+                const auto frame = self._renderer.frame();
+
+                const auto center_too_far = (std::abs(frame.center) > MaxCenterDistanceInPixels * frame.pixel_scale);
+                const auto scale_too_small = (frame.pixel_scale < MinPixelScale);
+
+                if (!center_too_far && !scale_too_small) {
+                    return;
+                }
+
+                auto [rebased_set, rebased_frame] = self._set.rebased(frame);
+
+                self._set = std::move(rebased_set);
+
+                self._renderer.set_frame(rebased_frame);
+
+                self._discard_pending();
+            }
         }
 
         void _translate_frame(this viewer &self, const _translation_info::offset shift) {
             /* NOTE: We move the frame the opposite direction. */
             self._renderer.translate_frame_by_coords(-shift.offset_x, -shift.offset_y);
+
+            self._discard_pending();
         }
 
         void _translate_pixels_and_update(this viewer &self, const _translation_info::offset shift) {
+            self._rebase_if_needed();
+
             self._renderer.translate_pixels_by_coords(shift.offset_x, shift.offset_y);
 
-            self._pool.threaded_render_missing_edges_by_iteration(
-                self._renderer,
-                self._set,
-                shift.offset_x,
-                shift.offset_y
-            );
+            self._with_set_for_frame(self._renderer.frame(), [&](const auto &set) {
+                self._pool.threaded_render_missing_edges_by_iteration(
+                    self._renderer,
+                    set,
+                    shift.offset_x,
+                    shift.offset_y
+                );
+            });
 
             self.update_window();
         }
@@ -293,7 +472,20 @@ namespace juliet {
         }
 
         void draw(this viewer &self) {
-            self._pool.threaded_render_by_iteration(self._renderer, self._set);
+            self._rebase_if_needed();
+            self._update_max_iterations();
+
+            self._with_set_for_frame(self._renderer.frame(), [&](const auto &set) {
+                if constexpr (_is_resumable) {
+                    auto pending = juliet::pending_orbits<juliet::set_scalar<decltype(set)>>{};
+
+                    self._pool.threaded_render_resumably(self._renderer, set, pending);
+
+                    self._pending.emplace(std::move(pending));
+                } else {
+                    self._pool.threaded_render_by_iteration(self._renderer, set);
+                }
+            });
 
             self.update_window();
         }
@@ -314,6 +506,10 @@ namespace juliet {
                     return true;
                 } break;
 
+                case sf::Keyboard::Key::I: {
+                    return self.iterate_further();
+                } break;
+
                 case sf::Keyboard::Key::Space: {
                     if constexpr (!_is_static_set) {
                         self._update_info.toggle_pause();
@@ -365,6 +561,8 @@ namespace juliet {
                     /* TODO: Shuffle pixels and render edges like with translation? Probably not. */
                     self._renderer.resize(juliet::resolution{event.size.x, event.size.y});
 
+                    self._discard_pending();
+
                     self._window.setView(sf::View(
                         sf::FloatRect(
                             {0, 0},
@@ -398,6 +596,8 @@ namespace juliet {
                         self._renderer.unscale_pixel_width(scale);
                     }
 
+                    self._discard_pending();
+
                     return true;
                 },
 
@@ -8,6 +8,9 @@ int main() {
     /* To just have a viewer for a static set, just pass it the set directly. */
     // auto app = juliet::viewer(512, 512, juliet::mandelbrot_set);
 
+    /* To zoom deeper than plain scalars allow, use the perturbation-based set. */
+    // auto app = juliet::viewer(512, 512, juliet::deep_mandelbrot_set{});
+
     /*
         To have a viewer for a set that changes based on the elapsed time,
         pass it a function which takes an elapsed duration and returns a set.